@@ -0,0 +1,261 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "gnl_reader.h"
+#include "gnl_record.h"
+#include "gnl_utf8.h"
+
+// libFuzzer / AFL harness for the line reader.
+//
+// The first input byte picks how the source chops the rest of the input
+// into reads; the reader is then run over the same bytes as one memory
+// span and as a chunked stream, and every mode must agree byte for byte.
+//
+//   libFuzzer: clang -fsanitize=fuzzer,address -DGNL_LIBFUZZER ...
+//   AFL / replay: build without GNL_LIBFUZZER and pass files (or stdin)
+
+#define CHECK(cond) do { if (!(cond)) { fprintf(stderr, "mismatch: %s (line %d)\n", #cond, __LINE__); abort(); } } while (0)
+
+typedef struct {
+    const uint8_t *data;
+    size_t size;
+    size_t pos;
+    uint32_t state;
+    uint8_t mode;
+} fuzz_source;
+
+static ssize_t fuzz_read(void *ctx, char *dst, size_t size) {
+    fuzz_source *src = ctx;
+    size_t n;
+
+    src->state = src->state * 1103515245u + 12345u;
+    if (src->mode % 4 == 0)
+        n = 1;
+    else if (src->mode % 4 == 1)
+        n = 1 + (src->state >> 16) % 7;
+    else if (src->mode % 4 == 2)
+        n = 1 + (src->state >> 8) % (GNL_BLOCK_SIZE + 3);
+    else
+        n = size;
+    if (n > size)
+        n = size;
+    if (n > src->size - src->pos)
+        n = src->size - src->pos;
+    memcpy(dst, src->data + src->pos, n);
+    src->pos += n;
+    return (ssize_t)n;
+}
+
+static void open_chunked(t_gnl_reader *reader, fuzz_source *src, const uint8_t *data, size_t size, uint8_t mode) {
+    src->data = data;
+    src->size = size;
+    src->pos = 0;
+    src->state = mode;
+    src->mode = mode;
+    CHECK(gnl_reader_init(reader, gnl_source_callback(fuzz_read, src)) == 0);
+}
+
+static void fuzz_lines(const uint8_t *data, size_t size, uint8_t mode) {
+    t_gnl_reader mem, chunked;
+    fuzz_source src;
+    t_gnl_view a, b;
+    size_t consumed = 0;
+
+    gnl_reader_init_mem(&mem, (const char *)data, size);
+    open_chunked(&chunked, &src, data, size, mode);
+    while (gnl_reader_next_view(&mem, &a) == GNL_LINE) {
+        CHECK(a.data == (const char *)data + consumed);
+        CHECK(a.len > 0);
+        CHECK(memchr(a.data, '\n', a.len) == NULL || memchr(a.data, '\n', a.len) == a.data + a.len - 1);
+        CHECK(gnl_reader_next_view(&chunked, &b) == GNL_LINE);
+        CHECK(a.len == b.len && memcmp(a.data, b.data, a.len) == 0);
+        consumed += a.len;
+    }
+    CHECK(consumed == size);
+    CHECK(gnl_reader_next_view(&chunked, &b) == GNL_EOF);
+    CHECK(mem.lines == chunked.lines && (size_t)chunked.offset == size);
+    gnl_reader_destroy(&mem);
+    gnl_reader_destroy(&chunked);
+}
+
+typedef struct {
+    size_t count;
+    size_t *start;
+    size_t *len;
+} ref_fields;
+
+static void ref_push(const uint8_t *data, size_t begin, size_t end, int quotes, ref_fields *out) {
+    int quoted = quotes && end - begin >= 2 && data[begin] == '"' && data[end - 1] == '"';
+    out->start[out->count] = begin + quoted;
+    out->len[out->count++] = end - begin - 2 * quoted;
+}
+
+// Reference CSV splitter, one byte at a time: a quote opens a quoted
+// section only as the first byte of a field, and "" inside one is a quote.
+// Returns the length of the record at data and fills in its fields.
+static size_t ref_record(const uint8_t *data, size_t size, char delim, int quotes, ref_fields *out) {
+    size_t begin = 0;
+    int state = 0;
+
+    out->count = 0;
+    for (size_t i = 0; i < size; i++) {
+        // 0: unquoted, 1: inside quotes, 2: just after a closing quote
+        if (state == 1) {
+            if (data[i] == '"')
+                state = 2;
+            continue;
+        }
+        if ((state == 2 || (quotes && i == begin)) && data[i] == '"') {
+            state = 1;
+            continue;
+        }
+        state = 0;
+        if (data[i] != delim && data[i] != '\n')
+            continue;
+        size_t end = i;
+        if (data[i] == '\n' && end > begin && data[end - 1] == '\r')
+            end--;
+        ref_push(data, begin, end, quotes, out);
+        begin = i + 1;
+        if (data[i] == '\n')
+            return i + 1;
+    }
+    ref_push(data, begin, size > begin && data[size - 1] == '\r' ? size - 1 : size, quotes, out);
+    return size;
+}
+
+static void fuzz_records(const uint8_t *data, size_t size, uint8_t mode) {
+    t_gnl_reader mem, chunked;
+    t_gnl_record ra, rb;
+    fuzz_source src;
+    char delim = (mode & 0x10) ? '\t' : ',';
+    int quotes = (mode & 0x20) != 0;
+    ref_fields ref = {0, malloc(sizeof(size_t) * (size + 1)), malloc(sizeof(size_t) * (size + 1))};
+    size_t consumed = 0;
+
+    gnl_reader_init_mem(&mem, (const char *)data, size);
+    open_chunked(&chunked, &src, data, size, mode);
+    CHECK(gnl_record_init(&ra, delim, quotes) == 0);
+    CHECK(gnl_record_init(&rb, delim, quotes) == 0);
+    while (gnl_reader_next_record(&mem, &ra) == GNL_LINE) {
+        CHECK(gnl_reader_next_record(&chunked, &rb) == GNL_LINE);
+        CHECK(ra.line.data == (const char *)data + consumed);
+        CHECK(ref_record(data + consumed, size - consumed, delim, quotes, &ref) == ra.line.len);
+        CHECK(ra.line.len == rb.line.len && memcmp(ra.line.data, rb.line.data, ra.line.len) == 0);
+        CHECK(ra.nfields == rb.nfields && ra.nfields == ref.count);
+        for (size_t i = 0; i < ra.nfields; i++) {
+            CHECK(ra.fields[i].start == ref.start[i] && ra.fields[i].len == ref.len[i]);
+            CHECK(ra.fields[i].start == rb.fields[i].start && ra.fields[i].len == rb.fields[i].len);
+        }
+        consumed += ra.line.len;
+    }
+    CHECK(consumed == size);
+    CHECK(gnl_reader_next_record(&chunked, &rb) == GNL_EOF);
+    free(ref.start);
+    free(ref.len);
+    gnl_record_destroy(&ra);
+    gnl_record_destroy(&rb);
+    gnl_reader_destroy(&mem);
+    gnl_reader_destroy(&chunked);
+}
+
+// Reference UTF-8 check: decode every sequence to its scalar value, then
+// reject overlong forms, surrogates and anything above U+10FFFF
+static int ref_utf8_valid(const unsigned char *s, size_t len) {
+    static const unsigned long min_cp[] = {0, 0, 0x80, 0x800, 0x10000};
+    size_t i = 0;
+    while (i < len) {
+        size_t n = 0;
+        if (s[i] < 0x80)
+            n = 1;
+        else if ((s[i] & 0xE0) == 0xC0)
+            n = 2;
+        else if ((s[i] & 0xF0) == 0xE0)
+            n = 3;
+        else if ((s[i] & 0xF8) == 0xF0)
+            n = 4;
+        if (n == 0 || i + n > len)
+            return 0;
+        unsigned long cp = n == 1 ? s[i] : s[i] & (0x7F >> n);
+        for (size_t k = 1; k < n; k++) {
+            if ((s[i + k] & 0xC0) != 0x80)
+                return 0;
+            cp = cp << 6 | (s[i + k] & 0x3F);
+        }
+        if (cp < min_cp[n] || (cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF)
+            return 0;
+        i += n;
+    }
+    return 1;
+}
+
+static void fuzz_utf8(const uint8_t *data, size_t size, uint8_t mode) {
+    t_gnl_reader mem, chunked;
+    t_gnl_utf8 ia, ib;
+    t_gnl_view a, b;
+    fuzz_source src;
+
+    gnl_reader_init_mem(&mem, (const char *)data, size);
+    open_chunked(&chunked, &src, data, size, mode);
+    while (gnl_reader_next_utf8(&mem, &a, &ia) == GNL_LINE) {
+        CHECK(gnl_reader_next_utf8(&chunked, &b, &ib) == GNL_LINE);
+        CHECK(a.len == b.len && memcmp(a.data, b.data, a.len) == 0);
+        CHECK(ia.valid == ib.valid && ia.ascii == ib.ascii && ia.codepoints == ib.codepoints);
+        CHECK(ia.codepoints <= a.len);
+        CHECK(ia.valid == ref_utf8_valid((const unsigned char *)a.data, a.len));
+        size_t leads = 0;
+        int ascii = 1;
+        for (size_t i = 0; i < a.len; i++) {
+            leads += ((unsigned char)a.data[i] & 0xC0) != 0x80;
+            ascii &= !((unsigned char)a.data[i] & 0x80);
+        }
+        CHECK(ia.ascii == ascii);
+        CHECK(!ia.valid || ia.codepoints == leads);
+    }
+    CHECK(gnl_reader_next_utf8(&chunked, &b, &ib) == GNL_EOF);
+    gnl_reader_destroy(&mem);
+    gnl_reader_destroy(&chunked);
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    if (size == 0)
+        return 0;
+    fuzz_lines(data + 1, size - 1, data[0]);
+    fuzz_records(data + 1, size - 1, data[0]);
+    fuzz_utf8(data + 1, size - 1, data[0]);
+    return 0;
+}
+
+#ifndef GNL_LIBFUZZER
+
+static void run_file(FILE *file) {
+    size_t cap = 4096, size = 0, n;
+    uint8_t *data = malloc(cap);
+
+    while ((n = fread(data + size, 1, cap - size, file)) > 0) {
+        size += n;
+        if (size == cap)
+            data = realloc(data, cap *= 2);
+    }
+    LLVMFuzzerTestOneInput(data, size);
+    free(data);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2)
+        run_file(stdin);
+    for (int i = 1; i < argc; i++) {
+        FILE *file = fopen(argv[i], "rb");
+        if (!file) {
+            perror(argv[i]);
+            return 1;
+        }
+        run_file(file);
+        fclose(file);
+    }
+    return 0;
+}
+
+#endif
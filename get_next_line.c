@@ -6,81 +6,104 @@
 /*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/07 16:44:47 by nyoong            #+#    #+#             */
-/*   Updated: 2024/11/12 19:12:37 by nyoong           ###   ########.fr       */
+/*   Updated: 2026/10/21 14:02:11 by nyoong           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include <unistd.h>
 #include "get_next_line.h"
 
-#ifndef BUFFER_SIZE
-# define BUFFER_SIZE 42
-#endif
+char	*gnl_grow_read(int fd, const char *saved, ssize_t *bytes_read)
+{
+	char	*grown;
+	size_t	len;
+	size_t	i;
+
+	len = 0;
+	if (saved)
+		len = ft_strlen(saved);
+	grown = (char *)malloc(len + BUFFER_SIZE + 1);
+	*bytes_read = GNL_ENOMEM;
+	if (!grown)
+		return (NULL);
+	*bytes_read = read(fd, grown + len, BUFFER_SIZE);
+	if (*bytes_read <= 0)
+	{
+		free(grown);
+		return (NULL);
+	}
+	grown[len + *bytes_read] = '\0';
+	i = 0;
+	while (i < len)
+	{
+		grown[i] = saved[i];
+		i++;
+	}
+	return (grown);
+}
 
 static char	*extract_and_update_buffer(char **saved)
 {
 	size_t	len;
+	size_t	i;
 	char	*line;
-	char	*new_saved;
 
 	len = 0;
 	while ((*saved)[len] && (*saved)[len] != '\n')
 		len++;
-	if ((*saved)[len] == '\n')
-		len++;
+	len += ((*saved)[len] == '\n');
 	line = ft_substr(*saved, 0, len);
-	if ((*saved)[len])
-	{
-		new_saved = ft_strdup(*saved + len);
-		free(*saved);
-		*saved = new_saved;
-	}
-	else
+	if (!line)
+		return (NULL);
+	i = 0;
+	while ((*saved)[len + i])
 	{
-		free(*saved);
-		*saved = NULL;
+		(*saved)[i] = (*saved)[len + i];
+		i++;
 	}
+	(*saved)[i] = '\0';
 	return (line);
 }
 
 static int	read_and_save(int fd, char **saved)
 {
-	char	buffer[BUFFER_SIZE + 1];
+	char	*grown;
 	ssize_t	bytes_read;
-	char	*temp;
 
-	bytes_read = read(fd, buffer, BUFFER_SIZE);
-	while (bytes_read > 0)
+	while (!*saved || !ft_strchr(*saved, '\n'))
 	{
-		buffer[bytes_read] = '\0';
-		if (*saved)
+		if (*saved && !**saved)
 		{
-			temp = ft_strjoin(*saved, buffer);
-			free(*saved);
-			*saved = temp;
+			bytes_read = read(fd, *saved, BUFFER_SIZE);
+			if (bytes_read <= 0)
+				return ((int)bytes_read);
+			(*saved)[bytes_read] = '\0';
 		}
 		else
-			*saved = ft_strdup(buffer);
-		if (ft_strchr(*saved, '\n'))
-			return (1);
-		bytes_read = read(fd, buffer, BUFFER_SIZE);
+		{
+			grown = gnl_grow_read(fd, *saved, &bytes_read);
+			if (!grown)
+				return ((int)bytes_read);
+			free(*saved);
+			*saved = grown;
+		}
 	}
-	if (bytes_read == 0 && (!*saved || **saved == '\0'))
-		return (0);
-	return (bytes_read);
+	return (1);
 }
 
 char	*get_next_line(int fd)
 {
 	static char	*saved;
-	char		*line;
+	int			status;
 
-	if (read_and_save(fd, &saved) <= 0 && (!saved || saved[0] == '\0'))
+	status = read_and_save(fd, &saved);
+	if (status == GNL_ENOMEM)
+		return (NULL);
+	if (status <= 0 && (!saved || saved[0] == '\0'))
 	{
 		free(saved);
 		saved = NULL;
 		return (NULL);
 	}
-	line = extract_and_update_buffer(&saved);
-	return (line);
+	return (extract_and_update_buffer(&saved));
 }
@@ -6,7 +6,7 @@
 /*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/07 16:44:52 by nyoong            #+#    #+#             */
-/*   Updated: 2024/11/07 16:45:18 by nyoong           ###   ########.fr       */
+/*   Updated: 2026/10/21 14:02:11 by nyoong           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,12 +15,20 @@
 
 # include <stddef.h>
 # include <stdlib.h>
+# include <sys/types.h>
+
+# ifndef BUFFER_SIZE
+#  define BUFFER_SIZE 42
+# endif
+
+# define GNL_ENOMEM -2
 
 size_t	ft_strlen(const char *str);
 char	*ft_strchr(const char *s, int c);
 char	*ft_strdup(const char *s1);
 char	*ft_substr(char const *s, unsigned int start, size_t len);
 char	*ft_strjoin(char const *s1, char const *s2);
+char	*gnl_grow_read(int fd, const char *saved, ssize_t *bytes_read);
 char	*get_next_line(int fd);
 
 #endif //GET_NEXT_LINE_H
\ No newline at end of file
@@ -6,45 +6,42 @@
 /*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/07 16:45:09 by nyoong            #+#    #+#             */
-/*   Updated: 2024/11/11 16:29:41 by nyoong           ###   ########.fr       */
+/*   Updated: 2026/10/21 14:20:37 by nyoong           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include <unistd.h>
 #include "get_next_line_bonus.h"
 
-#ifndef BUFFER_SIZE
-# define BUFFER_SIZE 42
-#endif
-
-static t_fd_buffer	*get_fd_buffer(t_fd_buffer **head, int fd)
+static t_fd_buffer	*get_fd_buffer(t_fd_pool *pool, int fd)
 {
 	t_fd_buffer	*current;
 	t_fd_buffer	*new_node;
 
-	current = *head;
+	current = pool->head;
 	while (current)
 	{
 		if (current->fd == fd)
 			return (current);
 		current = current->next;
 	}
-	new_node = (t_fd_buffer *)malloc(sizeof(t_fd_buffer));
+	new_node = gnl_pool_alloc(pool);
 	if (!new_node)
 		return (NULL);
 	new_node->fd = fd;
-	new_node->saved = NULL;
-	new_node->next = *head;
-	*head = new_node;
+	new_node->inline_data[0] = '\0';
+	new_node->saved = new_node->inline_data;
+	new_node->next = pool->head;
+	pool->head = new_node;
 	return (new_node);
 }
 
-static void	free_fd_buffer(t_fd_buffer **head, int fd)
+static void	free_fd_buffer(t_fd_pool *pool, int fd)
 {
 	t_fd_buffer	*current;
 	t_fd_buffer	*prev;
 
-	current = *head;
+	current = pool->head;
 	prev = NULL;
 	while (current)
 	{
@@ -53,9 +50,9 @@ static void	free_fd_buffer(t_fd_buffer **head, int fd)
 			if (prev)
 				prev->next = current->next;
 			else
-				*head = current->next;
-			free(current->saved);
-			free(current);
+				pool->head = current->next;
+			gnl_release_saved(current);
+			gnl_pool_free(pool, current);
 			return ;
 		}
 		prev = current;
@@ -63,76 +60,63 @@ static void	free_fd_buffer(t_fd_buffer **head, int fd)
 	}
 }
 
-static char	*extract_and_update_buffer(char **saved)
+static char	*extract_and_update_buffer(t_fd_buffer *node)
 {
 	size_t	len;
 	char	*line;
-	char	*new_saved;
 
 	len = 0;
-	while ((*saved)[len] && (*saved)[len] != '\n')
+	while (node->saved[len] && node->saved[len] != '\n')
 		len++;
-	if ((*saved)[len] == '\n')
+	if (node->saved[len] == '\n')
 		len++;
-	line = ft_substr(*saved, 0, len);
-	if ((*saved)[len])
-	{
-		new_saved = ft_strdup(*saved + len);
-		free(*saved);
-		*saved = new_saved;
-	}
-	else
-	{
-		free(*saved);
-		*saved = NULL;
-	}
+	line = ft_substr(node->saved, 0, len);
+	if (!line)
+		return (NULL);
+	gnl_store_saved(node, node->saved + len);
 	return (line);
 }
 
-static int	read_and_save(int fd, char **saved)
+static int	read_and_save(int fd, t_fd_buffer *node)
 {
-	char	buffer[BUFFER_SIZE + 1];
+	char	*grown;
 	ssize_t	bytes_read;
-	char	*temp;
 
-	bytes_read = read(fd, buffer, BUFFER_SIZE);
-	while (bytes_read > 0)
+	while (!node->saved || !ft_strchr(node->saved, '\n'))
 	{
-		buffer[bytes_read] = '\0';
-		if (*saved)
+		if (node->saved && !*node->saved)
+			bytes_read = gnl_refill(fd, node);
+		else
 		{
-			temp = ft_strjoin(*saved, buffer);
-			free(*saved);
-			*saved = temp;
+			grown = gnl_grow_read(fd, node->saved, &bytes_read);
+			if (grown)
+			{
+				gnl_release_saved(node);
+				node->saved = grown;
+			}
 		}
-		else
-			*saved = ft_strdup(buffer);
-		if (ft_strchr(*saved, '\n'))
-			return (1);
-		bytes_read = read(fd, buffer, BUFFER_SIZE);
+		if (bytes_read <= 0)
+			return ((int)bytes_read);
 	}
-	if (bytes_read == 0 && (!*saved || **saved == '\0'))
-		return (0);
-	return (bytes_read);
+	return (1);
 }
 
 char	*get_next_line(int fd)
 {
-	static t_fd_buffer	*head;
+	static t_fd_pool	pool;
 	t_fd_buffer			*fd_buffer;
-	char				*line;
+	int					status;
 
-	fd_buffer = get_fd_buffer(&head, fd);
-	if (!fd_buffer || read_and_save(fd, &fd_buffer->saved) < 0)
-	{
-		free_fd_buffer(&head, fd);
+	fd_buffer = get_fd_buffer(&pool, fd);
+	if (!fd_buffer)
 		return (NULL);
-	}
-	if (!fd_buffer->saved || fd_buffer->saved[0] == '\0')
+	status = read_and_save(fd, fd_buffer);
+	if (status == GNL_ENOMEM)
+		return (NULL);
+	if (status < 0 || !fd_buffer->saved || fd_buffer->saved[0] == '\0')
 	{
-		free_fd_buffer(&head, fd);
+		free_fd_buffer(&pool, fd);
 		return (NULL);
 	}
-	line = extract_and_update_buffer(&fd_buffer->saved);
-	return (line);
+	return (extract_and_update_buffer(fd_buffer));
 }
@@ -6,7 +6,7 @@
 /*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/07 16:45:02 by nyoong            #+#    #+#             */
-/*   Updated: 2024/11/07 16:45:13 by nyoong           ###   ########.fr       */
+/*   Updated: 2026/10/21 14:20:37 by nyoong           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,19 +15,55 @@
 
 # include <stddef.h>
 # include <stdlib.h>
+# include <sys/types.h>
+
+# ifndef BUFFER_SIZE
+#  define BUFFER_SIZE 42
+# endif
+
+# define GNL_ENOMEM -2
+
+# ifndef GNL_INLINE_SIZE
+#  define GNL_INLINE_SIZE 40
+# endif
+
+# ifndef GNL_SLAB_NODES
+#  define GNL_SLAB_NODES 64
+# endif
+
+# define GNL_CACHE_LINE 64
 
 typedef struct s_fd_buffer
 {
 	int					fd;
 	char				*saved;
 	struct s_fd_buffer	*next;
+	char				inline_data[GNL_INLINE_SIZE];
 }	t_fd_buffer;
 
+_Static_assert(sizeof(t_fd_buffer) <= GNL_CACHE_LINE,
+	"GNL_INLINE_SIZE is too large for one cache line per fd node");
+
+typedef struct s_fd_pool
+{
+	t_fd_buffer	*head;
+	t_fd_buffer	*free;
+	char		*slabs;
+	size_t		live;
+}	t_fd_pool;
+
 size_t	ft_strlen(const char *str);
 char	*ft_strchr(const char *s, int c);
 char	*ft_strdup(const char *s1);
 char	*ft_substr(char const *s, unsigned int start, size_t len);
 char	*ft_strjoin(char const *s1, char const *s2);
+char	*gnl_grow_read(int fd, const char *saved, ssize_t *bytes_read);
+ssize_t	gnl_refill(int fd, t_fd_buffer *node);
 char	*get_next_line(int fd);
 
+t_fd_buffer	*gnl_pool_alloc(t_fd_pool *pool);
+void		gnl_pool_free(t_fd_pool *pool, t_fd_buffer *node);
+void		gnl_release_saved(t_fd_buffer *node);
+void		gnl_store_saved(t_fd_buffer *node, const char *rest);
+
 #endif //GET_NEXT_LINE_BONUS_H
\ No newline at end of file
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_pool_bonus.c                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:18:22 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 14:20:37 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include "get_next_line_bonus.h"
+
+static int	pool_grow(t_fd_pool *pool)
+{
+	char		*raw;
+	t_fd_buffer	*nodes;
+	size_t		i;
+
+	raw = (char *)malloc(sizeof(char *) + GNL_CACHE_LINE
+			+ sizeof(t_fd_buffer) * GNL_SLAB_NODES);
+	if (!raw)
+		return (-1);
+	*(char **)raw = pool->slabs;
+	pool->slabs = raw;
+	nodes = (t_fd_buffer *)(((uintptr_t)(raw + sizeof(char *))
+				+ GNL_CACHE_LINE - 1) & ~(uintptr_t)(GNL_CACHE_LINE - 1));
+	i = 0;
+	while (i < GNL_SLAB_NODES)
+	{
+		nodes[i].next = pool->free;
+		pool->free = &nodes[i];
+		i++;
+	}
+	return (0);
+}
+
+t_fd_buffer	*gnl_pool_alloc(t_fd_pool *pool)
+{
+	t_fd_buffer	*node;
+
+	if (!pool->free && pool_grow(pool) < 0)
+		return (NULL);
+	node = pool->free;
+	pool->free = node->next;
+	pool->live++;
+	return (node);
+}
+
+void	gnl_pool_free(t_fd_pool *pool, t_fd_buffer *node)
+{
+	char	*next;
+
+	node->next = pool->free;
+	pool->free = node;
+	if (--pool->live > 0)
+		return ;
+	while (pool->slabs)
+	{
+		next = *(char **)pool->slabs;
+		free(pool->slabs);
+		pool->slabs = next;
+	}
+	pool->free = NULL;
+}
+
+void	gnl_release_saved(t_fd_buffer *node)
+{
+	if (node->saved != node->inline_data)
+		free(node->saved);
+	node->saved = NULL;
+}
+
+void	gnl_store_saved(t_fd_buffer *node, const char *rest)
+{
+	char	*dst;
+	size_t	i;
+
+	if (*rest == '\0')
+	{
+		node->saved[0] = '\0';
+		return ;
+	}
+	dst = node->saved;
+	if (ft_strlen(rest) < GNL_INLINE_SIZE)
+		dst = node->inline_data;
+	i = 0;
+	while (rest[i])
+	{
+		dst[i] = rest[i];
+		i++;
+	}
+	dst[i] = '\0';
+	if (dst != node->saved)
+		gnl_release_saved(node);
+	node->saved = dst;
+}
@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_read_bonus.c                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 14:18:05 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 14:18:05 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <unistd.h>
+#include "get_next_line_bonus.h"
+
+char	*gnl_grow_read(int fd, const char *saved, ssize_t *bytes_read)
+{
+	char	*grown;
+	size_t	len;
+	size_t	i;
+
+	len = 0;
+	if (saved)
+		len = ft_strlen(saved);
+	grown = (char *)malloc(len + BUFFER_SIZE + 1);
+	*bytes_read = GNL_ENOMEM;
+	if (!grown)
+		return (NULL);
+	*bytes_read = read(fd, grown + len, BUFFER_SIZE);
+	if (*bytes_read <= 0)
+	{
+		free(grown);
+		return (NULL);
+	}
+	grown[len + *bytes_read] = '\0';
+	i = 0;
+	while (i < len)
+	{
+		grown[i] = saved[i];
+		i++;
+	}
+	return (grown);
+}
+
+ssize_t	gnl_refill(int fd, t_fd_buffer *node)
+{
+	size_t	cap;
+	ssize_t	bytes_read;
+
+	cap = BUFFER_SIZE;
+	if (node->saved == node->inline_data && cap > GNL_INLINE_SIZE - 1)
+		cap = GNL_INLINE_SIZE - 1;
+	bytes_read = read(fd, node->saved, cap);
+	if (bytes_read > 0)
+		node->saved[bytes_read] = '\0';
+	return (bytes_read);
+}
@@ -6,7 +6,7 @@
 /*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/07 16:44:59 by nyoong            #+#    #+#             */
-/*   Updated: 2024/11/07 16:45:14 by nyoong           ###   ########.fr       */
+/*   Updated: 2026/10/21 14:20:37 by nyoong           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
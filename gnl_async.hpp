@@ -0,0 +1,288 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_async.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 12:10:26 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 15:03:26 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_ASYNC_HPP
+# define GNL_ASYNC_HPP
+
+# include <cerrno>
+# include <coroutine>
+# include <cstddef>
+# include <exception>
+# include <new>
+# include <optional>
+# include <string_view>
+# include <system_error>
+# include <fcntl.h>
+# include <sys/epoll.h>
+# include <unistd.h>
+
+extern "C"
+{
+# include "gnl_reader.h"
+}
+
+namespace gnl
+{
+
+// Eager coroutine: runs until its first suspension, resumption is driven by
+// an event_loop. The task owns the frame, so it must outlive the loop run.
+// An exception escaping the body is kept and rethrown by get(), or by
+// await_resume() when another coroutine co_awaits the task.
+class [[nodiscard]] task
+{
+public:
+	struct promise_type
+	{
+		struct final_awaiter
+		{
+			bool await_ready() noexcept { return (false); }
+			std::coroutine_handle<> await_suspend(
+				std::coroutine_handle<promise_type> h) noexcept
+			{
+				if (h.promise().continuation_)
+					return (h.promise().continuation_);
+				return (std::noop_coroutine());
+			}
+			void await_resume() noexcept {}
+		};
+
+		task get_return_object() noexcept
+		{
+			return (task(std::coroutine_handle<promise_type>::from_promise(
+						*this)));
+		}
+		std::suspend_never initial_suspend() noexcept { return {}; }
+		final_awaiter final_suspend() noexcept { return {}; }
+		void return_void() noexcept {}
+		void unhandled_exception() noexcept
+		{
+			error_ = std::current_exception();
+		}
+
+		std::exception_ptr		error_;
+		std::coroutine_handle<>	continuation_;
+	};
+
+	task(task &&other) noexcept : handle_(other.handle_)
+	{
+		other.handle_ = nullptr;
+	}
+
+	task &operator=(task &&other) noexcept
+	{
+		if (this != &other)
+		{
+			if (handle_)
+				handle_.destroy();
+			handle_ = other.handle_;
+			other.handle_ = nullptr;
+		}
+		return (*this);
+	}
+
+	~task()
+	{
+		if (handle_)
+			handle_.destroy();
+	}
+
+	bool done() const noexcept { return (!handle_ || handle_.done()); }
+
+	void get()
+	{
+		if (handle_ && handle_.promise().error_)
+			std::rethrow_exception(handle_.promise().error_);
+	}
+
+	bool await_ready() const noexcept { return (done()); }
+
+	void await_suspend(std::coroutine_handle<> h) noexcept
+	{
+		handle_.promise().continuation_ = h;
+	}
+
+	void await_resume() { get(); }
+
+private:
+	explicit task(std::coroutine_handle<promise_type> h) noexcept
+		: handle_(h) {}
+
+	std::coroutine_handle<promise_type>	handle_;
+};
+
+// Single-threaded epoll loop. Each armed fd fires once (EPOLLONESHOT) and
+// the waiter decides whether to re-arm or resume its coroutine.
+class event_loop
+{
+public:
+	struct waiter
+	{
+		virtual void on_ready() = 0;
+
+	protected:
+		~waiter() = default;
+	};
+
+	event_loop() : epfd_(epoll_create1(EPOLL_CLOEXEC))
+	{
+		if (epfd_ < 0)
+			throw std::system_error(errno, std::generic_category(),
+				"epoll_create1");
+	}
+
+	~event_loop() { close(epfd_); }
+
+	event_loop(const event_loop &) = delete;
+	event_loop &operator=(const event_loop &) = delete;
+
+	void arm(int fd, waiter *w)
+	{
+		epoll_event	ev{};
+
+		ev.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+		ev.data.ptr = w;
+		if (epoll_ctl(epfd_, EPOLL_CTL_MOD, fd, &ev) < 0
+			&& (errno != ENOENT || epoll_ctl(epfd_, EPOLL_CTL_ADD, fd, &ev) < 0))
+			throw std::system_error(errno, std::generic_category(),
+				"epoll_ctl");
+		armed_++;
+	}
+
+	void forget(int fd) noexcept
+	{
+		epoll_ctl(epfd_, EPOLL_CTL_DEL, fd, nullptr);
+	}
+
+	void run()
+	{
+		epoll_event	events[64];
+		int			n;
+
+		while (armed_ > 0)
+		{
+			n = epoll_wait(epfd_, events, 64, -1);
+			if (n < 0 && errno == EINTR)
+				continue ;
+			if (n < 0)
+				throw std::system_error(errno, std::generic_category(),
+					"epoll_wait");
+			for (int i = 0; i < n; i++)
+			{
+				armed_--;
+				static_cast<waiter *>(events[i].data.ptr)->on_ready();
+			}
+		}
+	}
+
+private:
+	int			epfd_;
+	std::size_t	armed_ = 0;
+};
+
+// Line stream over a non-blocking fd. `co_await stream.next()` yields a
+// view into the reader's buffer, valid until the following next(), or
+// std::nullopt at end of input. The fd stays owned by the caller and gets
+// its original flags back when the stream is destroyed.
+class async_line_stream
+{
+public:
+	class next_awaiter : public event_loop::waiter
+	{
+	public:
+		explicit next_awaiter(async_line_stream &s) : s_(s) {}
+
+		bool await_ready()
+		{
+			status_ = s_.poll();
+			return (status_ != GNL_AGAIN);
+		}
+
+		void await_suspend(std::coroutine_handle<> h)
+		{
+			handle_ = h;
+			s_.loop_.arm(s_.fd_, this);
+		}
+
+		void on_ready() override
+		{
+			status_ = s_.poll();
+			if (status_ == GNL_AGAIN)
+				s_.loop_.arm(s_.fd_, this);
+			else
+				handle_.resume();
+		}
+
+		std::optional<std::string_view> await_resume()
+		{
+			if (status_ == GNL_LINE)
+				return (std::string_view(s_.view_.data, s_.view_.len));
+			if (status_ == GNL_ENOMEM)
+				throw std::bad_alloc();
+			if (status_ < 0)
+				throw std::system_error(s_.errno_, std::generic_category(),
+					"gnl_reader_next_view");
+			return (std::nullopt);
+		}
+
+	private:
+		async_line_stream		&s_;
+		std::coroutine_handle<>	handle_;
+		int						status_ = GNL_EOF;
+	};
+
+	async_line_stream(event_loop &loop, int fd)
+		: loop_(loop), fd_(fd), flags_(fcntl(fd, F_GETFL))
+	{
+		if (flags_ < 0 || fcntl(fd, F_SETFL, flags_ | O_NONBLOCK) < 0)
+			throw std::system_error(errno, std::generic_category(), "fcntl");
+		if (gnl_reader_init(&reader_, gnl_source_fd(fd)) < 0)
+		{
+			fcntl(fd_, F_SETFL, flags_);
+			throw std::bad_alloc();
+		}
+	}
+
+	~async_line_stream()
+	{
+		loop_.forget(fd_);
+		gnl_reader_destroy(&reader_);
+		fcntl(fd_, F_SETFL, flags_);
+	}
+
+	async_line_stream(const async_line_stream &) = delete;
+	async_line_stream &operator=(const async_line_stream &) = delete;
+
+	next_awaiter next() { return (next_awaiter(*this)); }
+
+	const t_gnl_reader &reader() const noexcept { return (reader_); }
+
+private:
+	int poll()
+	{
+		int	status;
+
+		status = gnl_reader_next_view(&reader_, &view_);
+		errno_ = errno;
+		return (status);
+	}
+
+	event_loop		&loop_;
+	int				fd_;
+	int				flags_;
+	int				errno_ = 0;
+	t_gnl_reader	reader_;
+	t_gnl_view		view_{};
+};
+
+}
+
+#endif //GNL_ASYNC_HPP
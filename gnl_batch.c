@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_batch.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 18:14:02 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/20 18:44:19 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "gnl_batch.h"
+
+static int	batch_measure(t_gnl_reader *r, t_gnl_batch *b, size_t *used)
+{
+	char	*nl;
+	size_t	stop;
+	int		ret;
+
+	*used = 0;
+	nl = memchr(r->buf + r->scan, '\n', r->end - r->scan);
+	while (nl)
+	{
+		stop = nl + 1 - (r->buf + r->start);
+		if (b->count > 0 && b->size + stop > b->target)
+			return (1);
+		ret = gnl_batch_push(b, b->size + stop);
+		if (ret < 0)
+			return (ret);
+		*used = stop;
+		nl = memchr(nl + 1, '\n', r->buf + r->end - (nl + 1));
+	}
+	r->scan = r->end;
+	return (0);
+}
+
+static int	batch_take(t_gnl_reader *r, t_gnl_batch *b)
+{
+	size_t	before;
+	size_t	used;
+	int		full;
+
+	before = b->count;
+	full = batch_measure(r, b, &used);
+	if (full >= 0 && used > 0
+		&& gnl_batch_append(b, r->buf + r->start, used) < 0)
+		full = GNL_ENOMEM;
+	if (full < 0)
+	{
+		b->count = before;
+		return (full);
+	}
+	r->offset += used;
+	r->lines += b->count - before;
+	r->start += used;
+	if (r->scan < r->start)
+		r->scan = r->start;
+	return (full);
+}
+
+static int	batch_tail(t_gnl_reader *r, t_gnl_batch *b)
+{
+	size_t	len;
+
+	len = r->end - r->start;
+	if (len == 0 || (b->count > 0 && b->size + len > b->target))
+		return (GNL_EOF);
+	if (gnl_batch_push(b, b->size + len) < 0)
+		return (GNL_ENOMEM);
+	if (gnl_batch_append(b, r->buf + r->start, len) < 0)
+	{
+		b->count--;
+		return (GNL_ENOMEM);
+	}
+	r->offset += len;
+	r->lines++;
+	r->start = r->end;
+	r->scan = r->end;
+	return (GNL_EOF);
+}
+
+int	gnl_reader_next_batch(t_gnl_reader *r, t_gnl_batch *b)
+{
+	int	ret;
+
+	b->count = 0;
+	b->size = 0;
+	ret = batch_take(r, b);
+	while (ret == 0)
+	{
+		ret = gnl_reader_fill(r);
+		if (ret == 0)
+			ret = batch_tail(r, b);
+		if (ret <= 0)
+			break ;
+		ret = batch_take(r, b);
+	}
+	if (b->count > 0)
+		return (GNL_LINE);
+	if (ret < 0)
+		return (ret);
+	return (GNL_EOF);
+}
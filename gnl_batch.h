@@ -0,0 +1,40 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_batch.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 18:03:50 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/20 18:47:12 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_BATCH_H
+# define GNL_BATCH_H
+
+# include <stdint.h>
+# include "gnl_reader.h"
+
+# ifndef GNL_BATCH_TARGET
+#  define GNL_BATCH_TARGET 1048576
+# endif
+
+typedef struct s_gnl_batch
+{
+	char	*data;
+	int32_t	*offsets;
+	size_t	count;
+	size_t	size;
+	size_t	target;
+	size_t	data_cap;
+	size_t	offsets_cap;
+}	t_gnl_batch;
+
+int		gnl_batch_init(t_gnl_batch *b, size_t target);
+int		gnl_batch_push(t_gnl_batch *b, size_t end);
+int		gnl_batch_append(t_gnl_batch *b, const char *src, size_t len);
+void	gnl_batch_destroy(t_gnl_batch *b);
+int		gnl_reader_next_batch(t_gnl_reader *r, t_gnl_batch *b);
+
+#endif //GNL_BATCH_H
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_batch_utils.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 18:08:17 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/20 18:45:30 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "gnl_batch.h"
+
+static void	*batch_realloc(void *old, size_t used, size_t cap)
+{
+	void	*bigger;
+
+	if (posix_memalign(&bigger, GNL_CACHE_LINE, cap) != 0)
+		return (NULL);
+	if (used > 0)
+		memcpy(bigger, old, used);
+	free(old);
+	return (bigger);
+}
+
+int	gnl_batch_init(t_gnl_batch *b, size_t target)
+{
+	if (target == 0)
+		target = GNL_BATCH_TARGET;
+	b->target = target;
+	b->data_cap = (target + GNL_CACHE_LINE - 1) & ~(size_t)(GNL_CACHE_LINE - 1);
+	b->offsets_cap = GNL_CACHE_LINE;
+	b->count = 0;
+	b->size = 0;
+	b->data = (char *)batch_realloc(NULL, 0, b->data_cap);
+	b->offsets = (int32_t *)batch_realloc(NULL, 0,
+			sizeof(int32_t) * b->offsets_cap);
+	if (!b->data || !b->offsets)
+	{
+		gnl_batch_destroy(b);
+		return (GNL_ENOMEM);
+	}
+	b->offsets[0] = 0;
+	return (0);
+}
+
+int	gnl_batch_push(t_gnl_batch *b, size_t end)
+{
+	int32_t	*bigger;
+
+	if (end > INT32_MAX)
+		return (GNL_ERROR);
+	if (b->count + 2 > b->offsets_cap)
+	{
+		bigger = (int32_t *)batch_realloc(b->offsets,
+				sizeof(int32_t) * (b->count + 1),
+				sizeof(int32_t) * b->offsets_cap * 2);
+		if (!bigger)
+			return (GNL_ENOMEM);
+		b->offsets = bigger;
+		b->offsets_cap *= 2;
+	}
+	b->offsets[++b->count] = (int32_t)end;
+	return (0);
+}
+
+int	gnl_batch_append(t_gnl_batch *b, const char *src, size_t len)
+{
+	char	*bigger;
+	size_t	cap;
+
+	cap = b->data_cap;
+	while (cap < b->size + len)
+		cap *= 2;
+	if (cap > b->data_cap)
+	{
+		bigger = (char *)batch_realloc(b->data, b->size, cap);
+		if (!bigger)
+			return (GNL_ENOMEM);
+		b->data = bigger;
+		b->data_cap = cap;
+	}
+	memcpy(b->data + b->size, src, len);
+	b->size += len;
+	return (0);
+}
+
+void	gnl_batch_destroy(t_gnl_batch *b)
+{
+	free(b->data);
+	free(b->offsets);
+	b->data = NULL;
+	b->offsets = NULL;
+	b->count = 0;
+	b->size = 0;
+}
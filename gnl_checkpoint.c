@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_checkpoint.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 15:08:54 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/20 15:37:02 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <errno.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "gnl_checkpoint.h"
+
+static int	checkpoint_fingerprint(int fd, uint64_t offset, uint64_t *hash)
+{
+	char	probe[GNL_CHECKPOINT_PROBE];
+	size_t	len;
+	size_t	i;
+
+	len = GNL_CHECKPOINT_PROBE;
+	if (offset < len)
+		len = (size_t)offset;
+	if (gnl_pread_all(fd, probe, len, (off_t)(offset - len)) < 0)
+		return (GNL_ERROR);
+	*hash = 14695981039346656037ULL;
+	i = 0;
+	while (i < len)
+	{
+		*hash ^= (unsigned char)probe[i++];
+		*hash *= 1099511628211ULL;
+	}
+	return (0);
+}
+
+int	gnl_checkpoint_take(const t_gnl_reader *r, int fd, t_gnl_checkpoint *cp)
+{
+	struct stat	st;
+
+	if (fstat(fd, &st) < 0 || r->offset < 0)
+		return (GNL_ERROR);
+	memcpy(cp->magic, GNL_CHECKPOINT_MAGIC, 8);
+	cp->dev = (uint64_t)st.st_dev;
+	cp->ino = (uint64_t)st.st_ino;
+	cp->offset = (uint64_t)r->offset;
+	cp->lines = r->lines;
+	return (checkpoint_fingerprint(fd, cp->offset, &cp->fingerprint));
+}
+
+int	gnl_checkpoint_resume(t_gnl_reader *r, int fd, const t_gnl_checkpoint *cp)
+{
+	struct stat	st;
+	uint64_t	hash;
+
+	if (fstat(fd, &st) < 0)
+		return (GNL_ERROR);
+	if (memcmp(cp->magic, GNL_CHECKPOINT_MAGIC, 8) != 0
+		|| cp->dev != (uint64_t)st.st_dev || cp->ino != (uint64_t)st.st_ino
+		|| cp->offset > (uint64_t)st.st_size
+		|| checkpoint_fingerprint(fd, cp->offset, &hash) < 0
+		|| hash != cp->fingerprint)
+	{
+		errno = ESTALE;
+		return (GNL_ERROR);
+	}
+	return (gnl_reader_seek(r, (off_t)cp->offset, cp->lines));
+}
@@ -0,0 +1,43 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_checkpoint.h                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 15:03:27 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/20 15:40:19 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_CHECKPOINT_H
+# define GNL_CHECKPOINT_H
+
+# include <stdint.h>
+# include "gnl_reader.h"
+
+# define GNL_CHECKPOINT_MAGIC "GNLCKP01"
+
+# ifndef GNL_CHECKPOINT_PROBE
+#  define GNL_CHECKPOINT_PROBE 64
+# endif
+
+typedef struct s_gnl_checkpoint
+{
+	char		magic[8];
+	uint64_t	dev;
+	uint64_t	ino;
+	uint64_t	offset;
+	uint64_t	lines;
+	uint64_t	fingerprint;
+}	t_gnl_checkpoint;
+
+int		gnl_checkpoint_take(const t_gnl_reader *r, int fd,
+			t_gnl_checkpoint *cp);
+int		gnl_checkpoint_resume(t_gnl_reader *r, int fd,
+			const t_gnl_checkpoint *cp);
+
+int		gnl_checkpoint_save(const t_gnl_checkpoint *cp, const char *path);
+int		gnl_checkpoint_load(t_gnl_checkpoint *cp, const char *path);
+
+#endif //GNL_CHECKPOINT_H
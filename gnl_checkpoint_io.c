@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_checkpoint_io.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 15:14:40 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/20 15:38:11 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <fcntl.h>
+#include <limits.h>
+#include <string.h>
+#include <unistd.h>
+#include "gnl_checkpoint.h"
+
+static int	checkpoint_write(const t_gnl_checkpoint *cp, const char *tmp)
+{
+	int	fd;
+	int	ret;
+
+	fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return (GNL_ERROR);
+	ret = gnl_write_all(fd, cp, sizeof(t_gnl_checkpoint));
+	if (ret == 0 && fsync(fd) < 0)
+		ret = GNL_ERROR;
+	if (close(fd) < 0)
+		ret = GNL_ERROR;
+	return (ret);
+}
+
+int	gnl_checkpoint_save(const t_gnl_checkpoint *cp, const char *path)
+{
+	char	tmp[PATH_MAX];
+	size_t	len;
+
+	len = strlen(path);
+	if (len + 5 > sizeof(tmp))
+		return (GNL_ERROR);
+	memcpy(tmp, path, len);
+	memcpy(tmp + len, ".tmp", 5);
+	if (checkpoint_write(cp, tmp) < 0 || rename(tmp, path) < 0)
+	{
+		unlink(tmp);
+		return (GNL_ERROR);
+	}
+	return (0);
+}
+
+int	gnl_checkpoint_load(t_gnl_checkpoint *cp, const char *path)
+{
+	int	fd;
+	int	ret;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (GNL_ERROR);
+	ret = gnl_read_all(fd, cp, sizeof(t_gnl_checkpoint));
+	close(fd);
+	if (ret == 0 && memcmp(cp->magic, GNL_CHECKPOINT_MAGIC, 8) != 0)
+		ret = GNL_ERROR;
+	return (ret);
+}
@@ -0,0 +1,45 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_codec.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:04:48 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 09:12:40 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_CODEC_H
+# define GNL_CODEC_H
+
+# include <zlib.h>
+# ifdef GNL_ZSTD
+#  include <zstd.h>
+# endif
+# include "gnl_reader.h"
+
+typedef struct s_gnl_gzip
+{
+	z_stream		zs;
+	int				fd;
+	int				done;
+	int				ended;
+	unsigned char	in[GNL_BLOCK_SIZE];
+}	t_gnl_gzip;
+
+# ifdef GNL_ZSTD
+
+typedef struct s_gnl_zstd
+{
+	ZSTD_DStream	*ds;
+	ZSTD_inBuffer	in;
+	int				fd;
+	int				done;
+	size_t			pending;
+	unsigned char	block[GNL_BLOCK_SIZE];
+}	t_gnl_zstd;
+
+# endif
+
+#endif //GNL_CODEC_H
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_deque.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:26:39 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 11:22:48 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "gnl_scanner.h"
+
+int	gnl_deque_init(t_gnl_deque *d, size_t cap)
+{
+	atomic_init(&d->top, 0);
+	atomic_init(&d->bottom, 0);
+	d->cap = (long long)cap;
+	d->tasks = (t_gnl_task *)malloc(sizeof(t_gnl_task) * (cap + 1));
+	if (!d->tasks)
+		return (GNL_ERROR);
+	return (0);
+}
+
+int	gnl_deque_push(t_gnl_deque *d, const t_gnl_task *task)
+{
+	long long	b;
+
+	b = atomic_load_explicit(&d->bottom, memory_order_relaxed);
+	if (b - atomic_load_explicit(&d->top, memory_order_acquire) >= d->cap)
+		return (0);
+	d->tasks[b % d->cap] = *task;
+	atomic_thread_fence(memory_order_release);
+	atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+	return (1);
+}
+
+int	gnl_deque_take(t_gnl_deque *d, t_gnl_task *task)
+{
+	long long	b;
+	long long	t;
+	int			found;
+
+	b = atomic_load_explicit(&d->bottom, memory_order_relaxed) - 1;
+	atomic_store_explicit(&d->bottom, b, memory_order_relaxed);
+	atomic_thread_fence(memory_order_seq_cst);
+	t = atomic_load_explicit(&d->top, memory_order_relaxed);
+	found = (t <= b);
+	if (found)
+		*task = d->tasks[b % d->cap];
+	if (found && t == b)
+	{
+		found = atomic_compare_exchange_strong_explicit(&d->top, &t, t + 1,
+				memory_order_seq_cst, memory_order_relaxed);
+		atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+	}
+	else if (!found)
+		atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+	return (found);
+}
+
+int	gnl_deque_steal(t_gnl_deque *d, t_gnl_task *task)
+{
+	long long	t;
+	long long	b;
+
+	t = atomic_load_explicit(&d->top, memory_order_acquire);
+	atomic_thread_fence(memory_order_seq_cst);
+	b = atomic_load_explicit(&d->bottom, memory_order_acquire);
+	if (t >= b)
+		return (0);
+	*task = d->tasks[t % d->cap];
+	if (!atomic_compare_exchange_strong_explicit(&d->top, &t, t + 1,
+			memory_order_seq_cst, memory_order_relaxed))
+		return (GNL_ERROR);
+	return (1);
+}
+
+void	gnl_deque_destroy(t_gnl_deque *d)
+{
+	free(d->tasks);
+	d->tasks = NULL;
+	d->cap = 0;
+}
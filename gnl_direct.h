@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_direct.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 13:41:18 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 19:14:26 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_DIRECT_H
+# define GNL_DIRECT_H
+
+# include <fcntl.h>
+# include <sys/mman.h>
+# include "gnl_reader.h"
+
+# ifndef GNL_DIRECT_BLOCK
+#  define GNL_DIRECT_BLOCK 8388608
+# endif
+
+# define GNL_DIRECT_ALIGN 4096
+# define GNL_HUGE_PAGE 2097152
+
+# ifdef O_DIRECT
+#  define GNL_O_DIRECT O_DIRECT
+# else
+#  define GNL_O_DIRECT 0
+# endif
+
+# ifdef MAP_HUGETLB
+#  define GNL_MAP_HUGE MAP_HUGETLB
+# else
+#  define GNL_MAP_HUGE 0
+# endif
+
+# ifdef MADV_HUGEPAGE
+#  define GNL_MADV_HUGE MADV_HUGEPAGE
+# else
+#  define GNL_MADV_HUGE MADV_NORMAL
+# endif
+
+typedef struct s_gnl_direct
+{
+	int		fd;
+	int		direct;
+	char	*block;
+	size_t	size;
+	size_t	mapped;
+	size_t	head;
+	size_t	tail;
+	size_t	skip;
+	off_t	pos;
+}	t_gnl_direct;
+
+char	*gnl_direct_alloc(size_t size, size_t *mapped);
+int		gnl_direct_open(const char *path, int *direct);
+void	gnl_direct_uncache(int fd, off_t offset, size_t len);
+ssize_t	gnl_direct_pread(t_gnl_direct *d, char *dst, size_t size);
+int		gnl_reader_init_direct(t_gnl_reader *r, const char *path,
+			size_t block);
+
+#endif //GNL_DIRECT_H
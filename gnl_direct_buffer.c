@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_direct_buffer.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 13:48:52 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 19:14:26 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _GNU_SOURCE
+# define _GNU_SOURCE
+#endif
+#include <errno.h>
+#include <unistd.h>
+#include "gnl_direct.h"
+
+char	*gnl_direct_alloc(size_t size, size_t *mapped)
+{
+	void	*p;
+
+	p = MAP_FAILED;
+	*mapped = (size + GNL_HUGE_PAGE - 1) & ~(size_t)(GNL_HUGE_PAGE - 1);
+	if (GNL_MAP_HUGE && size >= GNL_HUGE_PAGE)
+		p = mmap(NULL, *mapped, PROT_READ | PROT_WRITE,
+				MAP_PRIVATE | MAP_ANONYMOUS | GNL_MAP_HUGE, -1, 0);
+	if (p != MAP_FAILED)
+		return ((char *)p);
+	*mapped = size;
+	p = mmap(NULL, size, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (p == MAP_FAILED)
+		return (NULL);
+	if (size >= GNL_HUGE_PAGE)
+		madvise(p, size, GNL_MADV_HUGE);
+	return ((char *)p);
+}
+
+int	gnl_direct_open(const char *path, int *direct)
+{
+	int	fd;
+
+	*direct = (GNL_O_DIRECT != 0);
+	fd = -1;
+	if (*direct)
+		fd = open(path, O_RDONLY | GNL_O_DIRECT);
+	if (fd < 0 && (!*direct || errno == EINVAL))
+	{
+		*direct = 0;
+		fd = open(path, O_RDONLY);
+	}
+	return (fd);
+}
+
+ssize_t	gnl_direct_pread(t_gnl_direct *d, char *dst, size_t size)
+{
+	ssize_t	got;
+
+	got = pread(d->fd, dst, size, d->pos);
+	if (got < 0 && errno == EINVAL && d->direct)
+	{
+		d->direct = 0;
+		fcntl(d->fd, F_SETFL, fcntl(d->fd, F_GETFL) & ~GNL_O_DIRECT);
+		got = pread(d->fd, dst, size, d->pos);
+	}
+	if (got > 0 && !d->direct)
+		gnl_direct_uncache(d->fd, d->pos, (size_t)got);
+	if (got > 0)
+		d->pos += got;
+	return (got);
+}
+
+#ifdef POSIX_FADV_DONTNEED
+
+void	gnl_direct_uncache(int fd, off_t offset, size_t len)
+{
+	posix_fadvise(fd, offset, (off_t)len, POSIX_FADV_DONTNEED);
+}
+
+#else
+
+void	gnl_direct_uncache(int fd, off_t offset, size_t len)
+{
+	(void)fd;
+	(void)offset;
+	(void)len;
+}
+
+#endif
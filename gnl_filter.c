@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_filter.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:09:44 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 18:31:05 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "gnl_filter.h"
+
+static const char	*find_literal(const char *s, size_t len, const char *pat,
+		size_t plen)
+{
+	const char	*hit;
+	const char	*last;
+
+	if (plen == 0)
+		return (s);
+	if (plen > len)
+		return (NULL);
+	last = s + len - plen;
+	hit = memchr(s, pat[0], last - s + 1);
+	while (hit && memcmp(hit, pat, plen) != 0)
+	{
+		if (hit == last)
+			return (NULL);
+		hit = memchr(hit + 1, pat[0], last - hit);
+	}
+	return (hit);
+}
+
+static const char	*filter_search(t_gnl_reader *r, const t_gnl_filter *f)
+{
+	const char	*base;
+	const char	*best;
+	const char	*hit;
+	size_t		limit;
+	size_t		i;
+
+	base = r->buf + r->scan;
+	best = NULL;
+	limit = r->end - r->scan;
+	i = 0;
+	while (i < f->count)
+	{
+		hit = find_literal(base, limit, f->patterns[i], f->lens[i]);
+		if (hit && (!best || hit < best))
+		{
+			best = hit;
+			if (f->maxlen && (size_t)(hit - base) + f->maxlen <= limit)
+				limit = (hit - base) + f->maxlen - 1;
+		}
+		i++;
+	}
+	return (best);
+}
+
+static void	skip_lines(t_gnl_reader *r, size_t limit)
+{
+	char	*nl;
+
+	nl = memchr(r->buf + r->start, '\n', limit - r->start);
+	while (nl)
+	{
+		r->lines++;
+		r->offset += nl + 1 - (r->buf + r->start);
+		r->start = nl + 1 - r->buf;
+		nl = memchr(r->buf + r->start, '\n', limit - r->start);
+	}
+}
+
+static int	filter_refill(t_gnl_reader *r, const t_gnl_filter *f)
+{
+	int	ret;
+
+	skip_lines(r, r->end);
+	r->scan = r->start;
+	if (f->maxlen > 0 && r->end - r->start >= f->maxlen)
+		r->scan = r->end - f->maxlen + 1;
+	ret = gnl_reader_fill(r);
+	if (ret != 0)
+		return (ret);
+	r->offset += r->end - r->start;
+	r->lines += (r->end > r->start);
+	r->start = r->end;
+	r->scan = r->end;
+	return (GNL_EOF);
+}
+
+int	gnl_reader_next_match(t_gnl_reader *r, const t_gnl_filter *f,
+		t_gnl_view *line)
+{
+	const char	*hit;
+	int			ret;
+
+	hit = filter_search(r, f);
+	while (!hit)
+	{
+		ret = filter_refill(r, f);
+		if (ret <= 0)
+			return (ret);
+		hit = filter_search(r, f);
+	}
+	skip_lines(r, hit - r->buf);
+	r->scan = hit - r->buf;
+	return (gnl_reader_next_view(r, line));
+}
@@ -0,0 +1,32 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_filter.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:02:18 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/19 15:02:18 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_FILTER_H
+# define GNL_FILTER_H
+
+# include "gnl_reader.h"
+
+typedef struct s_gnl_filter
+{
+	const char	**patterns;
+	size_t		*lens;
+	size_t		count;
+	size_t		maxlen;
+}	t_gnl_filter;
+
+int		gnl_filter_init(t_gnl_filter *f, const char **patterns, size_t count);
+void	gnl_filter_destroy(t_gnl_filter *f);
+int		gnl_reader_next_match(t_gnl_reader *r, const t_gnl_filter *f,
+			t_gnl_view *line);
+char	*gnl_reader_next_matching(t_gnl_reader *r, const t_gnl_filter *f);
+
+#endif //GNL_FILTER_H
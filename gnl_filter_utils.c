@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_filter_utils.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:16:03 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 18:31:05 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "gnl_filter.h"
+
+int	gnl_filter_init(t_gnl_filter *f, const char **patterns, size_t count)
+{
+	size_t	i;
+
+	f->patterns = patterns;
+	f->count = count;
+	f->maxlen = 0;
+	f->lens = (size_t *)malloc(sizeof(size_t) * (count + 1));
+	if (!f->lens)
+		return (GNL_ERROR);
+	i = 0;
+	while (i < count)
+	{
+		f->lens[i] = strlen(patterns[i]);
+		if (memchr(patterns[i], '\n', f->lens[i]))
+		{
+			free(f->lens);
+			f->lens = NULL;
+			return (GNL_ERROR);
+		}
+		if (f->lens[i] > f->maxlen)
+			f->maxlen = f->lens[i];
+		i++;
+	}
+	return (0);
+}
+
+void	gnl_filter_destroy(t_gnl_filter *f)
+{
+	free(f->lens);
+	f->lens = NULL;
+	f->count = 0;
+}
+
+char	*gnl_reader_next_matching(t_gnl_reader *r, const t_gnl_filter *f)
+{
+	t_gnl_view	view;
+	char		*line;
+
+	if (gnl_reader_next_match(r, f, &view) != GNL_LINE)
+		return (NULL);
+	line = (char *)malloc(view.len + 1);
+	if (!line)
+	{
+		gnl_reader_unread(r, &view);
+		return (NULL);
+	}
+	memcpy(line, view.data, view.len);
+	line[view.len] = '\0';
+	return (line);
+}
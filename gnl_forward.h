@@ -0,0 +1,25 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_forward.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 10:12:47 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/20 10:12:47 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_FORWARD_H
+# define GNL_FORWARD_H
+
+# include "gnl_reader.h"
+
+# ifndef GNL_FORWARD_SCAN
+#  define GNL_FORWARD_SCAN 4096
+# endif
+
+ssize_t	gnl_forward_file(int src, int dst, off_t *pos);
+ssize_t	gnl_forward_stream(t_gnl_reader *r, int dst);
+
+#endif //GNL_FORWARD_H
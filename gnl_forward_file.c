@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_forward_file.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 10:20:31 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 18:50:44 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <errno.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+# include <sys/sendfile.h>
+#endif
+#include "gnl_forward.h"
+
+static off_t	last_line_end(int fd, off_t from, off_t to)
+{
+	char	block[GNL_FORWARD_SCAN];
+	size_t	len;
+	size_t	i;
+
+	while (to > from)
+	{
+		len = GNL_FORWARD_SCAN;
+		if ((off_t)len > to - from)
+			len = (size_t)(to - from);
+		if (gnl_pread_all(fd, block, len, to - len) < 0)
+			return (GNL_ERROR);
+		i = len;
+		while (i > 0 && block[i - 1] != '\n')
+			i--;
+		if (i > 0)
+			return (to - len + i);
+		to -= len;
+	}
+	return (from);
+}
+
+static ssize_t	copy_range(int src, int dst, off_t *pos, size_t len)
+{
+	char	block[GNL_FORWARD_SCAN];
+	size_t	chunk;
+	size_t	done;
+	ssize_t	written;
+
+	done = 0;
+	while (done < len)
+	{
+		chunk = len - done;
+		if (chunk > GNL_FORWARD_SCAN)
+			chunk = GNL_FORWARD_SCAN;
+		if (gnl_pread_all(src, block, chunk, *pos) < 0)
+			return (GNL_ERROR);
+		written = gnl_write_some(dst, block, chunk);
+		if (written < 0 && done == 0)
+			return (written);
+		if (written < 0)
+			break ;
+		*pos += written;
+		done += written;
+		if ((size_t)written < chunk)
+			break ;
+	}
+	return ((ssize_t)done);
+}
+
+#ifdef __linux__
+
+static ssize_t	send_range(int src, int dst, off_t *pos, size_t len)
+{
+	ssize_t	sent;
+	size_t	done;
+
+	done = 0;
+	sent = 0;
+	while (done < len)
+	{
+		sent = sendfile(dst, src, pos, len - done);
+		if (sent < 0 && errno == EINTR)
+			continue ;
+		if (sent < 0 && done == 0 && (errno == EINVAL || errno == ENOSYS))
+			return (copy_range(src, dst, pos, len));
+		if (sent <= 0)
+			break ;
+		done += sent;
+	}
+	if (done > 0)
+		return ((ssize_t)done);
+	if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+		return (GNL_AGAIN);
+	return (GNL_ERROR);
+}
+
+#else
+
+static ssize_t	send_range(int src, int dst, off_t *pos, size_t len)
+{
+	return (copy_range(src, dst, pos, len));
+}
+
+#endif
+
+ssize_t	gnl_forward_file(int src, int dst, off_t *pos)
+{
+	struct stat	st;
+	off_t		end;
+
+	if (fstat(src, &st) < 0 || !S_ISREG(st.st_mode))
+		return (GNL_ERROR);
+	end = last_line_end(src, *pos, st.st_size);
+	if (end < 0)
+		return (GNL_ERROR);
+	if (end == *pos)
+		return (0);
+	return (send_range(src, dst, pos, (size_t)(end - *pos)));
+}
@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_forward_stream.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 10:34:09 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 12:07:10 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "gnl_forward.h"
+
+static const char	*rfind_nl(const char *s, size_t len)
+{
+	while (len > 0)
+	{
+		if (s[len - 1] == '\n')
+			return (s + len - 1);
+		len--;
+	}
+	return (NULL);
+}
+
+static void	count_lines(t_gnl_reader *r, size_t stop)
+{
+	const char	*nl;
+
+	nl = memchr(r->buf + r->start, '\n', stop - r->start);
+	while (nl)
+	{
+		r->lines++;
+		nl = memchr(nl + 1, '\n', r->buf + stop - nl - 1);
+	}
+}
+
+ssize_t	gnl_forward_stream(t_gnl_reader *r, int dst)
+{
+	const char	*nl;
+	ssize_t		written;
+	int			ret;
+
+	nl = rfind_nl(r->buf + r->scan, r->end - r->scan);
+	while (!nl)
+	{
+		r->scan = r->end;
+		ret = gnl_reader_fill(r);
+		if (ret <= 0)
+			return (ret);
+		nl = rfind_nl(r->buf + r->scan, r->end - r->scan);
+	}
+	written = gnl_write_some(dst, r->buf + r->start,
+			nl + 1 - (r->buf + r->start));
+	if (written < 0)
+		return (written);
+	count_lines(r, r->start + written);
+	r->offset += written;
+	r->start += written;
+	r->scan = r->start;
+	return (written);
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_index.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:14:51 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/19 13:14:51 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "gnl_index.h"
+
+int	gnl_index_init(t_gnl_index *idx, size_t stride)
+{
+	if (stride == 0)
+		stride = 1;
+	idx->stride = stride;
+	idx->count = 0;
+	idx->lines = 0;
+	idx->cap = 64;
+	idx->offsets = (off_t *)malloc(sizeof(off_t) * idx->cap);
+	if (!idx->offsets)
+		return (GNL_ERROR);
+	return (0);
+}
+
+int	gnl_index_track(t_gnl_index *idx, const t_gnl_reader *r)
+{
+	off_t	*bigger;
+
+	if (r->lines % idx->stride || r->lines / idx->stride != idx->count)
+		return (0);
+	if (idx->count == idx->cap)
+	{
+		bigger = (off_t *)malloc(sizeof(off_t) * idx->cap * 2);
+		if (!bigger)
+			return (GNL_ERROR);
+		memcpy(bigger, idx->offsets, sizeof(off_t) * idx->count);
+		free(idx->offsets);
+		idx->offsets = bigger;
+		idx->cap *= 2;
+	}
+	idx->offsets[idx->count++] = r->offset;
+	return (0);
+}
+
+int	gnl_index_build(t_gnl_index *idx, t_gnl_reader *r)
+{
+	t_gnl_view	view;
+	int			ret;
+
+	ret = GNL_LINE;
+	while (ret == GNL_LINE)
+	{
+		if (gnl_index_track(idx, r) < 0)
+			return (GNL_ERROR);
+		ret = gnl_reader_next_view(r, &view);
+	}
+	if (ret < 0)
+		return (ret);
+	if (idx->count > 1 && (idx->count - 1) * idx->stride == r->lines)
+		idx->count--;
+	if (r->lines > idx->lines)
+		idx->lines = r->lines;
+	return (0);
+}
+
+int	gnl_index_seek(const t_gnl_index *idx, t_gnl_reader *r, size_t n)
+{
+	size_t		block;
+	t_gnl_view	view;
+	int			ret;
+
+	if (idx->count == 0)
+		return (GNL_ERROR);
+	block = n / idx->stride;
+	if (block >= idx->count)
+		block = idx->count - 1;
+	if (gnl_reader_seek(r, idx->offsets[block], block * idx->stride) < 0)
+		return (GNL_ERROR);
+	while (r->lines < n)
+	{
+		ret = gnl_reader_next_view(r, &view);
+		if (ret != GNL_LINE)
+			return (ret);
+	}
+	return (GNL_LINE);
+}
+
+void	gnl_index_destroy(t_gnl_index *idx)
+{
+	free(idx->offsets);
+	idx->offsets = NULL;
+	idx->count = 0;
+	idx->cap = 0;
+}
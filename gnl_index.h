@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_index.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:10:09 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 10:02:15 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_INDEX_H
+# define GNL_INDEX_H
+
+# include <stdint.h>
+# include "gnl_reader.h"
+
+# define GNL_INDEX_MAGIC "GNLIDX02"
+
+typedef struct s_gnl_index
+{
+	off_t	*offsets;
+	size_t	count;
+	size_t	cap;
+	size_t	stride;
+	size_t	lines;
+}	t_gnl_index;
+
+typedef struct s_gnl_index_header
+{
+	char		magic[8];
+	uint64_t	stride;
+	uint64_t	lines;
+	uint64_t	count;
+	uint64_t	src_size;
+	uint64_t	src_mtime;
+	uint64_t	src_mtime_ns;
+	uint64_t	src_ino;
+}	t_gnl_index_header;
+
+int		gnl_index_init(t_gnl_index *idx, size_t stride);
+int		gnl_index_track(t_gnl_index *idx, const t_gnl_reader *r);
+int		gnl_index_build(t_gnl_index *idx, t_gnl_reader *r);
+int		gnl_index_seek(const t_gnl_index *idx, t_gnl_reader *r, size_t n);
+void	gnl_index_destroy(t_gnl_index *idx);
+
+int		gnl_index_save(const t_gnl_index *idx, const char *path, int src_fd);
+int		gnl_index_load(t_gnl_index *idx, const char *path, int src_fd);
+
+#endif //GNL_INDEX_H
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_index_io.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:21:37 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 10:04:51 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "gnl_index.h"
+
+static int	index_identity(t_gnl_index_header *header, int src_fd)
+{
+	struct stat	st;
+
+	if (fstat(src_fd, &st) < 0)
+		return (GNL_ERROR);
+	header->src_size = st.st_size;
+	header->src_mtime = st.st_mtim.tv_sec;
+	header->src_mtime_ns = st.st_mtim.tv_nsec;
+	header->src_ino = st.st_ino;
+	return (0);
+}
+
+int	gnl_index_save(const t_gnl_index *idx, const char *path, int src_fd)
+{
+	t_gnl_index_header	header;
+	int					fd;
+	int					ret;
+
+	memcpy(header.magic, GNL_INDEX_MAGIC, 8);
+	header.stride = idx->stride;
+	header.lines = idx->lines;
+	header.count = idx->count;
+	if (index_identity(&header, src_fd) < 0)
+		return (GNL_ERROR);
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return (GNL_ERROR);
+	ret = gnl_write_all(fd, &header, sizeof(header));
+	if (ret == 0)
+		ret = gnl_write_all(fd, idx->offsets, sizeof(off_t) * idx->count);
+	if (close(fd) < 0)
+		ret = GNL_ERROR;
+	return (ret);
+}
+
+static int	index_check(const t_gnl_index_header *header, int fd, int src_fd)
+{
+	t_gnl_index_header	source;
+	struct stat			st;
+
+	if (memcmp(header->magic, GNL_INDEX_MAGIC, 8) != 0
+		|| header->stride == 0
+		|| header->count > SIZE_MAX / sizeof(off_t) - 1
+		|| fstat(fd, &st) < 0
+		|| (uint64_t)st.st_size != sizeof(*header)
+		+ header->count * sizeof(off_t)
+		|| index_identity(&source, src_fd) < 0)
+		return (GNL_ERROR);
+	if (header->src_size != source.src_size
+		|| header->src_mtime != source.src_mtime
+		|| header->src_mtime_ns != source.src_mtime_ns
+		|| header->src_ino != source.src_ino)
+		return (GNL_ERROR);
+	return (0);
+}
+
+static int	index_load_fd(t_gnl_index *idx, int fd, int src_fd)
+{
+	t_gnl_index_header	header;
+	off_t				*offsets;
+
+	if (gnl_read_all(fd, &header, sizeof(header)) < 0
+		|| index_check(&header, fd, src_fd) < 0)
+		return (GNL_ERROR);
+	offsets = (off_t *)malloc(sizeof(off_t) * (header.count + 1));
+	if (!offsets)
+		return (GNL_ENOMEM);
+	if (gnl_read_all(fd, offsets, sizeof(off_t) * header.count) < 0)
+	{
+		free(offsets);
+		return (GNL_ERROR);
+	}
+	idx->offsets = offsets;
+	idx->stride = header.stride;
+	idx->lines = header.lines;
+	idx->count = header.count;
+	idx->cap = header.count + 1;
+	return (0);
+}
+
+int	gnl_index_load(t_gnl_index *idx, const char *path, int src_fd)
+{
+	int	fd;
+	int	ret;
+
+	memset(idx, 0, sizeof(*idx));
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (GNL_ERROR);
+	ret = index_load_fd(idx, fd, src_fd);
+	close(fd);
+	return (ret);
+}
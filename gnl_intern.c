@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_intern.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 16:07:45 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 16:40:12 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "gnl_intern.h"
+
+uint64_t	gnl_hash(const char *data, size_t len)
+{
+	uint64_t	h;
+	uint64_t	w;
+
+	h = 0x9E3779B97F4A7C15ULL ^ len;
+	while (len >= 8)
+	{
+		memcpy(&w, data, 8);
+		h = (h ^ w) * 0xFF51AFD7ED558CCDULL;
+		h ^= h >> 32;
+		data += 8;
+		len -= 8;
+	}
+	w = 0;
+	memcpy(&w, data, len);
+	h = (h ^ w) * 0xC4CEB9FE1A85EC53ULL;
+	h ^= h >> 29;
+	return (h);
+}
+
+static t_gnl_line	*intern_find(t_gnl_intern *t, const char *data, size_t len,
+		uint64_t hash)
+{
+	t_gnl_line	*line;
+
+	line = t->buckets[hash & t->mask];
+	while (line)
+	{
+		if (line->hash == hash && line->len == len
+			&& memcmp(line->data, data, len) == 0)
+			return (line);
+		line = line->chain;
+	}
+	return (NULL);
+}
+
+static t_gnl_line	*intern_insert(t_gnl_intern *t, const char *data,
+		size_t len, uint64_t hash)
+{
+	t_gnl_line	*line;
+
+	line = (t_gnl_line *)malloc(sizeof(t_gnl_line) + len + 1);
+	if (!line)
+		return (NULL);
+	if (t->count == t->max)
+		gnl_intern_evict(t);
+	memcpy(line->data, data, len);
+	line->data[len] = '\0';
+	line->hash = hash;
+	atomic_init(&line->refs, 1);
+	line->len = len;
+	line->prev = NULL;
+	line->next = NULL;
+	line->chain = t->buckets[hash & t->mask];
+	t->buckets[hash & t->mask] = line;
+	t->count++;
+	return (line);
+}
+
+static void	intern_touch(t_gnl_intern *t, t_gnl_line *line)
+{
+	if (t->head == line)
+		return ;
+	if (line->prev)
+		line->prev->next = line->next;
+	if (line->next)
+		line->next->prev = line->prev;
+	if (t->tail == line)
+		t->tail = line->prev;
+	line->prev = NULL;
+	line->next = t->head;
+	if (t->head)
+		t->head->prev = line;
+	t->head = line;
+	if (!t->tail)
+		t->tail = line;
+}
+
+t_gnl_line	*gnl_intern_view(t_gnl_intern *t, const char *data, size_t len)
+{
+	t_gnl_line	*line;
+	uint64_t	hash;
+
+	hash = gnl_hash(data, len);
+	line = intern_find(t, data, len, hash);
+	if (!line)
+		line = intern_insert(t, data, len, hash);
+	if (!line)
+		return (NULL);
+	intern_touch(t, line);
+	atomic_fetch_add_explicit(&line->refs, 1, memory_order_relaxed);
+	return (line);
+}
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_intern.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 16:02:11 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 16:40:12 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_INTERN_H
+# define GNL_INTERN_H
+
+# include <stdatomic.h>
+# include <stdint.h>
+# include "gnl_reader.h"
+
+# ifndef GNL_INTERN_MAX
+#  define GNL_INTERN_MAX 4096
+# endif
+
+typedef struct s_gnl_line
+{
+	uint64_t			hash;
+	atomic_size_t		refs;
+	size_t				len;
+	struct s_gnl_line	*chain;
+	struct s_gnl_line	*prev;
+	struct s_gnl_line	*next;
+	char				data[];
+}	t_gnl_line;
+
+typedef struct s_gnl_intern
+{
+	t_gnl_line	**buckets;
+	size_t		mask;
+	size_t		count;
+	size_t		max;
+	t_gnl_line	*head;
+	t_gnl_line	*tail;
+}	t_gnl_intern;
+
+uint64_t	gnl_hash(const char *data, size_t len);
+t_gnl_line	*gnl_intern_view(t_gnl_intern *t, const char *data, size_t len);
+
+int			gnl_intern_init(t_gnl_intern *t, size_t max);
+void		gnl_intern_evict(t_gnl_intern *t);
+void		gnl_line_release(t_gnl_line *line);
+void		gnl_intern_destroy(t_gnl_intern *t);
+t_gnl_line	*gnl_reader_next_interned(t_gnl_reader *r, t_gnl_intern *t);
+
+#endif //GNL_INTERN_H
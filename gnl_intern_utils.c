@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_intern_utils.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 16:15:20 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 16:40:12 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "gnl_intern.h"
+
+int	gnl_intern_init(t_gnl_intern *t, size_t max)
+{
+	size_t	size;
+
+	if (max == 0)
+		max = GNL_INTERN_MAX;
+	size = 16;
+	while (size < max)
+		size *= 2;
+	t->buckets = (t_gnl_line **)calloc(size, sizeof(t_gnl_line *));
+	if (!t->buckets)
+		return (GNL_ENOMEM);
+	t->mask = size - 1;
+	t->count = 0;
+	t->max = max;
+	t->head = NULL;
+	t->tail = NULL;
+	return (0);
+}
+
+void	gnl_intern_evict(t_gnl_intern *t)
+{
+	t_gnl_line	*line;
+	t_gnl_line	**link;
+
+	line = t->tail;
+	if (!line)
+		return ;
+	t->tail = line->prev;
+	if (t->tail)
+		t->tail->next = NULL;
+	else
+		t->head = NULL;
+	link = &t->buckets[line->hash & t->mask];
+	while (*link != line)
+		link = &(*link)->chain;
+	*link = line->chain;
+	t->count--;
+	gnl_line_release(line);
+}
+
+void	gnl_line_release(t_gnl_line *line)
+{
+	if (line && atomic_fetch_sub_explicit(&line->refs, 1,
+			memory_order_acq_rel) == 1)
+		free(line);
+}
+
+void	gnl_intern_destroy(t_gnl_intern *t)
+{
+	while (t->tail)
+		gnl_intern_evict(t);
+	free(t->buckets);
+	t->buckets = NULL;
+	t->mask = 0;
+}
+
+t_gnl_line	*gnl_reader_next_interned(t_gnl_reader *r, t_gnl_intern *t)
+{
+	t_gnl_view	view;
+	t_gnl_line	*line;
+
+	if (gnl_reader_next_view(r, &view) != GNL_LINE)
+		return (NULL);
+	line = gnl_intern_view(t, view.data, view.len);
+	if (!line)
+		gnl_reader_unread(r, &view);
+	return (line);
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_io.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 10:05:13 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 12:05:33 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <errno.h>
+#include <unistd.h>
+#include "gnl_reader.h"
+
+ssize_t	gnl_write_some(int fd, const void *data, size_t len)
+{
+	size_t	done;
+	ssize_t	written;
+
+	done = 0;
+	written = 0;
+	while (done < len)
+	{
+		written = write(fd, (const char *)data + done, len - done);
+		if (written < 0 && errno == EINTR)
+			continue ;
+		if (written <= 0)
+			break ;
+		done += written;
+	}
+	if (done > 0 || len == 0)
+		return ((ssize_t)done);
+	if (written < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+		return (GNL_AGAIN);
+	return (GNL_ERROR);
+}
+
+int	gnl_write_all(int fd, const void *data, size_t len)
+{
+	ssize_t	written;
+
+	while (len > 0)
+	{
+		written = gnl_write_some(fd, data, len);
+		if (written <= 0)
+			return (GNL_ERROR);
+		data = (const char *)data + written;
+		len -= written;
+	}
+	return (0);
+}
+
+int	gnl_read_all(int fd, void *data, size_t len)
+{
+	ssize_t	bytes_read;
+
+	while (len > 0)
+	{
+		bytes_read = read(fd, data, len);
+		if (bytes_read <= 0)
+			return (GNL_ERROR);
+		data = (char *)data + bytes_read;
+		len -= bytes_read;
+	}
+	return (0);
+}
+
+int	gnl_pread_all(int fd, char *dst, size_t len, off_t offset)
+{
+	ssize_t	bytes_read;
+
+	while (len > 0)
+	{
+		bytes_read = pread(fd, dst, len, offset);
+		if (bytes_read <= 0)
+			return (GNL_ERROR);
+		dst += bytes_read;
+		len -= bytes_read;
+		offset += bytes_read;
+	}
+	return (0);
+}
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_mux.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 17:10:03 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 17:05:33 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <errno.h>
+#include <string.h>
+#include "gnl_mux.h"
+
+static int	mux_take(t_gnl_reader *r, t_gnl_view *line)
+{
+	char	*nl;
+
+	nl = memchr(r->buf + r->scan, '\n', r->end - r->scan);
+	if (!nl)
+	{
+		r->scan = r->end;
+		return (0);
+	}
+	return (gnl_reader_emit(r, line, nl + 1 - r->buf));
+}
+
+static int	mux_visit(t_gnl_mux *m, size_t i, t_gnl_view *line)
+{
+	t_gnl_reader	*r;
+	int				ret;
+
+	r = &m->readers[i];
+	if (mux_take(r, line))
+		return (GNL_LINE);
+	if (m->slots[i].spent >= m->budget || !m->pfds[i].revents)
+		return (GNL_AGAIN);
+	ret = gnl_reader_fill(r);
+	if (ret == GNL_AGAIN)
+		m->pfds[i].revents = 0;
+	if (ret > 0 && mux_take(r, line))
+		return (GNL_LINE);
+	if (ret > 0)
+		ret = GNL_AGAIN;
+	if (ret == GNL_AGAIN || ret == GNL_ENOMEM)
+		return (ret);
+	m->pfds[i].fd = -1;
+	m->live--;
+	if (ret == 0 && r->start < r->end)
+		return (gnl_reader_emit(r, line, r->end));
+	return (ret);
+}
+
+static int	mux_pass(t_gnl_mux *m, size_t *which, t_gnl_view *line)
+{
+	size_t	visited;
+	size_t	i;
+	int		ret;
+
+	visited = 0;
+	while (visited++ < m->count)
+	{
+		i = m->cursor;
+		m->cursor = (m->cursor + 1) % m->count;
+		if (m->pfds[i].fd < 0)
+			continue ;
+		ret = mux_visit(m, i, line);
+		if (ret != GNL_AGAIN && ret != GNL_EOF)
+		{
+			*which = i;
+			return (ret);
+		}
+	}
+	return (GNL_AGAIN);
+}
+
+static int	mux_new_round(t_gnl_mux *m)
+{
+	size_t	i;
+	int		exhausted;
+
+	exhausted = 0;
+	i = 0;
+	while (i < m->count)
+	{
+		if (m->pfds[i].fd >= 0 && m->slots[i].spent >= m->budget)
+			exhausted = 1;
+		m->slots[i++].spent = 0;
+	}
+	return (exhausted);
+}
+
+int	gnl_mux_next(t_gnl_mux *m, size_t *which, t_gnl_view *line, int timeout)
+{
+	struct timespec	start;
+	int				exhausted;
+	int				ret;
+
+	if (timeout > 0)
+		clock_gettime(CLOCK_MONOTONIC, &start);
+	while (m->live > 0)
+	{
+		ret = mux_pass(m, which, line);
+		if (ret != GNL_AGAIN)
+			return (ret);
+		if (m->live == 0)
+			break ;
+		exhausted = mux_new_round(m);
+		if (exhausted)
+			ret = poll(m->pfds, m->count, 0);
+		else
+			ret = gnl_mux_poll(m, timeout, &start);
+		if (ret < 0 && errno != EINTR)
+			return (GNL_ERROR);
+		if (ret == 0 && !exhausted)
+			return (GNL_AGAIN);
+	}
+	return (GNL_EOF);
+}
@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_mux.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 17:04:36 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 17:05:33 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_MUX_H
+# define GNL_MUX_H
+
+# include <poll.h>
+# include <time.h>
+# include "gnl_reader.h"
+
+# ifndef GNL_MUX_BUDGET
+#  define GNL_MUX_BUDGET GNL_BLOCK_SIZE
+# endif
+
+typedef struct s_gnl_mux_slot
+{
+	int		fd;
+	int		flags;
+	size_t	spent;
+	size_t	budget;
+}	t_gnl_mux_slot;
+
+typedef struct s_gnl_mux
+{
+	t_gnl_reader	*readers;
+	struct pollfd	*pfds;
+	t_gnl_mux_slot	*slots;
+	size_t			count;
+	size_t			cursor;
+	size_t			budget;
+	size_t			live;
+}	t_gnl_mux;
+
+int		gnl_mux_init(t_gnl_mux *m, const int *fds, size_t count,
+			size_t budget);
+int		gnl_mux_next(t_gnl_mux *m, size_t *which, t_gnl_view *line,
+			int timeout);
+int		gnl_mux_poll(t_gnl_mux *m, int timeout,
+			const struct timespec *start);
+void	gnl_mux_destroy(t_gnl_mux *m);
+
+#endif //GNL_MUX_H
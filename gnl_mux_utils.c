@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_mux_utils.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 17:16:29 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 17:05:33 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "gnl_mux.h"
+
+static ssize_t	mux_read(void *ctx, char *dst, size_t size)
+{
+	t_gnl_mux_slot	*slot;
+	ssize_t			bytes_read;
+
+	slot = (t_gnl_mux_slot *)ctx;
+	if (size > slot->budget - slot->spent)
+		size = slot->budget - slot->spent;
+	bytes_read = read(slot->fd, dst, size);
+	if (bytes_read < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+		return (GNL_AGAIN);
+	if (bytes_read > 0)
+		slot->spent += bytes_read;
+	return (bytes_read);
+}
+
+static int	mux_open(t_gnl_mux *m, size_t i, int fd)
+{
+	int	flags;
+
+	flags = fcntl(fd, F_GETFL);
+	if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0)
+		return (GNL_ERROR);
+	m->slots[i].fd = fd;
+	m->slots[i].flags = flags;
+	m->slots[i].spent = 0;
+	m->slots[i].budget = m->budget;
+	if (gnl_reader_init(&m->readers[i], gnl_source_callback(mux_read,
+				&m->slots[i])) < 0)
+	{
+		fcntl(fd, F_SETFL, flags);
+		return (GNL_ENOMEM);
+	}
+	m->pfds[i].fd = fd;
+	m->pfds[i].events = POLLIN;
+	m->pfds[i].revents = POLLIN;
+	return (0);
+}
+
+int	gnl_mux_poll(t_gnl_mux *m, int timeout, const struct timespec *start)
+{
+	struct timespec	now;
+	long			elapsed_ms;
+
+	if (timeout > 0)
+	{
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		elapsed_ms = (now.tv_sec - start->tv_sec) * 1000L
+			+ (now.tv_nsec - start->tv_nsec) / 1000000;
+		if (elapsed_ms >= timeout)
+			timeout = 0;
+		else
+			timeout -= (int)elapsed_ms;
+	}
+	return (poll(m->pfds, m->count, timeout));
+}
+
+int	gnl_mux_init(t_gnl_mux *m, const int *fds, size_t count, size_t budget)
+{
+	int	ret;
+
+	m->readers = (t_gnl_reader *)malloc(sizeof(t_gnl_reader) * count);
+	m->pfds = (struct pollfd *)malloc(sizeof(struct pollfd) * count);
+	m->slots = (t_gnl_mux_slot *)malloc(sizeof(t_gnl_mux_slot) * count);
+	m->cursor = 0;
+	m->budget = budget;
+	if (budget == 0)
+		m->budget = GNL_MUX_BUDGET;
+	m->count = 0;
+	ret = GNL_ENOMEM;
+	if (m->readers && m->pfds && m->slots)
+		ret = 0;
+	while (ret == 0 && m->count < count)
+	{
+		ret = mux_open(m, m->count, fds[m->count]);
+		m->count += (ret == 0);
+	}
+	m->live = m->count;
+	if (ret < 0)
+		gnl_mux_destroy(m);
+	return (ret);
+}
+
+void	gnl_mux_destroy(t_gnl_mux *m)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < m->count)
+	{
+		fcntl(m->slots[i].fd, F_SETFL, m->slots[i].flags);
+		gnl_reader_destroy(&m->readers[i++]);
+	}
+	free(m->readers);
+	free(m->pfds);
+	free(m->slots);
+	m->readers = NULL;
+	m->pfds = NULL;
+	m->slots = NULL;
+	m->count = 0;
+	m->live = 0;
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_pipeline.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:38:15 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 10:50:13 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "gnl_pipeline.h"
+
+static int	pipeline_publish(t_gnl_pipeline *p, t_gnl_slab **slab,
+		const t_gnl_view *line)
+{
+	t_gnl_item	item;
+
+	if (!*slab || (*slab)->cap - (*slab)->used < line->len)
+	{
+		if (*slab)
+			gnl_slab_unref(p, *slab);
+		*slab = gnl_slab_acquire(p, line->len);
+		if (!*slab)
+			return (GNL_ERROR);
+	}
+	item.data = (*slab)->data + (*slab)->used;
+	item.len = line->len;
+	item.slab = *slab;
+	memcpy((*slab)->data + (*slab)->used, line->data, line->len);
+	(*slab)->used += line->len;
+	atomic_fetch_add_explicit(&(*slab)->refs, 1, memory_order_relaxed);
+	gnl_ring_push_wait(&p->lines, &item);
+	return (0);
+}
+
+static void	*pipeline_produce(void *arg)
+{
+	t_gnl_pipeline	*p;
+	t_gnl_slab		*slab;
+	t_gnl_view		line;
+	int				ret;
+
+	p = (t_gnl_pipeline *)arg;
+	slab = NULL;
+	ret = gnl_reader_next_view(&p->reader, &line);
+	while (ret == GNL_LINE)
+	{
+		if (pipeline_publish(p, &slab, &line) < 0)
+			break ;
+		ret = gnl_reader_next_view(&p->reader, &line);
+	}
+	if (slab)
+		gnl_slab_unref(p, slab);
+	p->error = (ret != GNL_EOF);
+	atomic_store_explicit(&p->done, 1, memory_order_release);
+	gnl_ring_wake(&p->lines);
+	return (NULL);
+}
+
+int	gnl_pipeline_start(t_gnl_pipeline *p, t_gnl_source src,
+		size_t slab_size, size_t nslabs)
+{
+	memset(p, 0, sizeof(*p));
+	if (slab_size == 0 || nslabs == 0)
+		return (GNL_ERROR);
+	p->slab_size = slab_size;
+	p->nslabs = nslabs;
+	atomic_init(&p->done, 0);
+	if (gnl_ring_init(&p->lines, GNL_RING_SIZE) < 0
+		|| gnl_ring_init(&p->free_slabs, nslabs) < 0
+		|| gnl_slab_pool_init(p) < 0
+		|| gnl_reader_init(&p->reader, src) < 0
+		|| pthread_create(&p->thread, NULL, pipeline_produce, p) != 0)
+	{
+		gnl_reader_destroy(&p->reader);
+		gnl_slab_pool_destroy(p);
+		gnl_ring_destroy(&p->free_slabs);
+		gnl_ring_destroy(&p->lines);
+		return (GNL_ERROR);
+	}
+	return (0);
+}
+
+int	gnl_pipeline_pop(t_gnl_pipeline *p, t_gnl_item *item)
+{
+	if (gnl_ring_pop_wait(&p->lines, item, &p->done))
+		return (GNL_LINE);
+	if (p->error)
+		return (GNL_ERROR);
+	return (GNL_EOF);
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_pipeline.h                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:05:31 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 10:41:07 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_PIPELINE_H
+# define GNL_PIPELINE_H
+
+# include <pthread.h>
+# include <stdatomic.h>
+# include "gnl_reader.h"
+
+# ifndef GNL_RING_SIZE
+#  define GNL_RING_SIZE 4096
+# endif
+
+# ifndef GNL_SPIN_LIMIT
+#  define GNL_SPIN_LIMIT 64
+# endif
+
+typedef struct s_gnl_slab
+{
+	atomic_size_t	refs;
+	size_t			used;
+	size_t			cap;
+	int				pooled;
+	char			*data;
+}	t_gnl_slab;
+
+typedef struct s_gnl_item
+{
+	const char	*data;
+	size_t		len;
+	t_gnl_slab	*slab;
+}	t_gnl_item;
+
+typedef struct s_gnl_cell
+{
+	atomic_size_t	seq;
+	t_gnl_item		item;
+	char			pad[GNL_CACHE_LINE - sizeof(atomic_size_t)
+		- sizeof(t_gnl_item)];
+}	t_gnl_cell;
+
+typedef struct s_gnl_ring
+{
+	atomic_size_t	head;
+	char			pad_head[GNL_CACHE_LINE - sizeof(atomic_size_t)];
+	atomic_size_t	tail;
+	char			pad_tail[GNL_CACHE_LINE - sizeof(atomic_size_t)];
+	t_gnl_cell		*cells;
+	size_t			mask;
+	atomic_int		waiters;
+	pthread_mutex_t	lock;
+	pthread_cond_t	wake;
+}	t_gnl_ring;
+
+typedef struct s_gnl_pipeline
+{
+	t_gnl_ring		lines;
+	t_gnl_ring		free_slabs;
+	t_gnl_reader	reader;
+	t_gnl_slab		*slabs;
+	size_t			nslabs;
+	size_t			slab_size;
+	atomic_int		done;
+	int				error;
+	pthread_t		thread;
+}	t_gnl_pipeline;
+
+int			gnl_ring_init(t_gnl_ring *q, size_t size);
+int			gnl_ring_push(t_gnl_ring *q, const t_gnl_item *item);
+int			gnl_ring_pop(t_gnl_ring *q, t_gnl_item *item);
+void		gnl_ring_destroy(t_gnl_ring *q);
+int			gnl_ring_push_wait(t_gnl_ring *q, const t_gnl_item *item);
+int			gnl_ring_pop_wait(t_gnl_ring *q, t_gnl_item *item,
+				atomic_int *done);
+void		gnl_ring_wake(t_gnl_ring *q);
+
+int			gnl_pipeline_start(t_gnl_pipeline *p, t_gnl_source src,
+				size_t slab_size, size_t nslabs);
+int			gnl_pipeline_pop(t_gnl_pipeline *p, t_gnl_item *item);
+void		gnl_pipeline_release(t_gnl_pipeline *p, const t_gnl_item *item);
+int			gnl_pipeline_join(t_gnl_pipeline *p);
+
+int			gnl_slab_pool_init(t_gnl_pipeline *p);
+t_gnl_slab	*gnl_slab_acquire(t_gnl_pipeline *p, size_t len);
+void		gnl_slab_unref(t_gnl_pipeline *p, t_gnl_slab *slab);
+void		gnl_slab_pool_destroy(t_gnl_pipeline *p);
+
+#endif //GNL_PIPELINE_H
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_pipeline_slab.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:24:47 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 10:51:40 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "gnl_pipeline.h"
+
+int	gnl_slab_pool_init(t_gnl_pipeline *p)
+{
+	t_gnl_item	item;
+	size_t		i;
+
+	p->slabs = (t_gnl_slab *)malloc(sizeof(t_gnl_slab) * p->nslabs);
+	if (!p->slabs)
+		return (GNL_ERROR);
+	i = 0;
+	while (i < p->nslabs)
+	{
+		p->slabs[i].data = (char *)malloc(p->slab_size);
+		p->slabs[i].cap = p->slab_size;
+		p->slabs[i].pooled = 1;
+		item.slab = &p->slabs[i];
+		if (!p->slabs[i].data || !gnl_ring_push(&p->free_slabs, &item))
+		{
+			p->nslabs = i + (p->slabs[i].data != NULL);
+			return (GNL_ERROR);
+		}
+		i++;
+	}
+	return (0);
+}
+
+static t_gnl_slab	*slab_oversize(size_t len)
+{
+	t_gnl_slab	*slab;
+
+	slab = (t_gnl_slab *)malloc(sizeof(t_gnl_slab));
+	if (!slab)
+		return (NULL);
+	slab->data = (char *)malloc(len);
+	if (!slab->data)
+	{
+		free(slab);
+		return (NULL);
+	}
+	slab->cap = len;
+	slab->pooled = 0;
+	return (slab);
+}
+
+t_gnl_slab	*gnl_slab_acquire(t_gnl_pipeline *p, size_t len)
+{
+	t_gnl_item	item;
+
+	if (len > p->slab_size)
+		item.slab = slab_oversize(len);
+	else
+		gnl_ring_pop_wait(&p->free_slabs, &item, NULL);
+	if (!item.slab)
+		return (NULL);
+	item.slab->used = 0;
+	atomic_store(&item.slab->refs, 1);
+	return (item.slab);
+}
+
+void	gnl_slab_unref(t_gnl_pipeline *p, t_gnl_slab *slab)
+{
+	t_gnl_item	item;
+
+	if (atomic_fetch_sub_explicit(&slab->refs, 1, memory_order_acq_rel) != 1)
+		return ;
+	if (!slab->pooled)
+	{
+		free(slab->data);
+		free(slab);
+		return ;
+	}
+	item.slab = slab;
+	gnl_ring_push_wait(&p->free_slabs, &item);
+}
+
+void	gnl_slab_pool_destroy(t_gnl_pipeline *p)
+{
+	size_t	i;
+
+	i = 0;
+	while (p->slabs && i < p->nslabs)
+		free(p->slabs[i++].data);
+	free(p->slabs);
+	p->slabs = NULL;
+	p->nslabs = 0;
+}
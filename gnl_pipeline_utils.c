@@ -0,0 +1,33 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_pipeline_utils.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:41:52 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/19 16:41:52 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "gnl_pipeline.h"
+
+void	gnl_pipeline_release(t_gnl_pipeline *p, const t_gnl_item *item)
+{
+	gnl_slab_unref(p, item->slab);
+}
+
+int	gnl_pipeline_join(t_gnl_pipeline *p)
+{
+	int	error;
+
+	pthread_join(p->thread, NULL);
+	error = p->error;
+	gnl_reader_destroy(&p->reader);
+	gnl_slab_pool_destroy(p);
+	gnl_ring_destroy(&p->free_slabs);
+	gnl_ring_destroy(&p->lines);
+	if (error)
+		return (GNL_ERROR);
+	return (0);
+}
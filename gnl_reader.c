@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_reader.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:02:31 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 15:50:02 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "gnl_reader.h"
+
+int	gnl_reader_init(t_gnl_reader *r, t_gnl_source src)
+{
+	r->src = src;
+	r->cap = GNL_BLOCK_SIZE;
+	r->start = 0;
+	r->scan = 0;
+	r->end = 0;
+	r->borrowed = 0;
+	r->align = 0;
+	r->offset = 0;
+	r->lines = 0;
+	r->on_fill = NULL;
+	r->hook_ctx = NULL;
+	r->reserve = NULL;
+	r->reserve_size = 0;
+	r->buf = (char *)malloc(r->cap);
+	if (!r->buf)
+		return (GNL_ERROR);
+	return (0);
+}
+
+int	gnl_reader_emit(t_gnl_reader *r, t_gnl_view *line, size_t stop)
+{
+	line->data = r->buf + r->start;
+	line->len = stop - r->start;
+	r->start = stop;
+	r->scan = stop;
+	r->offset += line->len;
+	r->lines++;
+	return (GNL_LINE);
+}
+
+void	gnl_reader_unread(t_gnl_reader *r, const t_gnl_view *line)
+{
+	r->start = line->data - r->buf;
+	r->scan = r->start;
+	r->offset -= line->len;
+	r->lines--;
+}
+
+int	gnl_reader_next_view(t_gnl_reader *r, t_gnl_view *line)
+{
+	char	*nl;
+	int		ret;
+
+	nl = memchr(r->buf + r->scan, '\n', r->end - r->scan);
+	while (!nl)
+	{
+		r->scan = r->end;
+		ret = gnl_reader_fill(r);
+		if (ret < 0)
+			return (ret);
+		if (ret == 0 && r->start == r->end)
+			return (GNL_EOF);
+		if (ret == 0)
+			return (gnl_reader_emit(r, line, r->end));
+		nl = memchr(r->buf + r->scan, '\n', r->end - r->scan);
+	}
+	return (gnl_reader_emit(r, line, nl + 1 - r->buf));
+}
+
+void	gnl_reader_destroy(t_gnl_reader *r)
+{
+	if (r->src.close)
+		r->src.close(r->src.ctx);
+	if (!r->borrowed)
+		free(r->buf);
+	free(r->reserve);
+	r->reserve = NULL;
+	r->reserve_size = 0;
+	r->buf = NULL;
+	r->cap = 0;
+	r->start = 0;
+	r->scan = 0;
+	r->end = 0;
+}
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_reader.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:02:14 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 15:50:02 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_READER_H
+# define GNL_READER_H
+
+# include <stddef.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <sys/types.h>
+
+# ifndef GNL_BLOCK_SIZE
+#  define GNL_BLOCK_SIZE 65536
+# endif
+
+# define GNL_CACHE_LINE 64
+
+# define GNL_ONES 0x0101010101010101ULL
+# define GNL_HIGHS 0x8080808080808080ULL
+
+# define GNL_LINE 1
+# define GNL_EOF 0
+# define GNL_ERROR -1
+# define GNL_ENOMEM -2
+# define GNL_AGAIN -3
+
+typedef ssize_t	(*t_gnl_read_fn)(void *ctx, char *dst, size_t size);
+typedef void	(*t_gnl_close_fn)(void *ctx);
+typedef int		(*t_gnl_seek_fn)(void *ctx, off_t offset);
+typedef int		(*t_gnl_hook_fn)(void *ctx, int recycle);
+
+typedef struct s_gnl_source
+{
+	t_gnl_read_fn	read;
+	t_gnl_close_fn	close;
+	t_gnl_seek_fn	seek;
+	void			*ctx;
+}	t_gnl_source;
+
+typedef struct s_gnl_view
+{
+	const char	*data;
+	size_t		len;
+}	t_gnl_view;
+
+typedef struct s_gnl_reader
+{
+	t_gnl_source	src;
+	char			*buf;
+	size_t			cap;
+	size_t			start;
+	size_t			scan;
+	size_t			end;
+	int				borrowed;
+	size_t			align;
+	off_t			offset;
+	size_t			lines;
+	t_gnl_hook_fn	on_fill;
+	void			*hook_ctx;
+	char			*reserve;
+	size_t			reserve_size;
+}	t_gnl_reader;
+
+typedef struct s_gnl_pread
+{
+	int		fd;
+	off_t	pos;
+}	t_gnl_pread;
+
+int				gnl_reader_init(t_gnl_reader *r, t_gnl_source src);
+void			gnl_reader_init_mem(t_gnl_reader *r, const char *data,
+					size_t len);
+int				gnl_reader_next_view(t_gnl_reader *r, t_gnl_view *line);
+char			*gnl_reader_next(t_gnl_reader *r);
+char			*gnl_reader_copy(t_gnl_reader *r, const t_gnl_view *view);
+void			gnl_reader_destroy(t_gnl_reader *r);
+
+int				gnl_reader_fill(t_gnl_reader *r);
+int				gnl_reader_emit(t_gnl_reader *r, t_gnl_view *line, size_t stop);
+int				gnl_reader_seek(t_gnl_reader *r, off_t offset, size_t lines);
+void			gnl_reader_unread(t_gnl_reader *r, const t_gnl_view *line);
+int				gnl_reader_reserve(t_gnl_reader *r, size_t size);
+int				gnl_reader_resize(t_gnl_reader *r, size_t cap);
+int				gnl_reader_shift(t_gnl_reader *r);
+int				gnl_reader_align(t_gnl_reader *r, size_t align);
+
+ssize_t			gnl_write_some(int fd, const void *data, size_t len);
+int				gnl_write_all(int fd, const void *data, size_t len);
+int				gnl_read_all(int fd, void *data, size_t len);
+int				gnl_pread_all(int fd, char *dst, size_t len, off_t offset);
+
+t_gnl_source	gnl_source_fd(int fd);
+int				gnl_source_pread(int fd, off_t offset, t_gnl_source *out);
+t_gnl_source	gnl_source_file(FILE *file);
+t_gnl_source	gnl_source_callback(t_gnl_read_fn read, void *ctx);
+int				gnl_source_gzip(int fd, t_gnl_source *out);
+int				gnl_source_zstd(int fd, t_gnl_source *out);
+int				gnl_source_direct(const char *path, size_t block,
+					t_gnl_source *out);
+
+#endif //GNL_READER_H
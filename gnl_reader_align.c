@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_reader_align.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 15:48:30 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 15:48:30 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "gnl_reader.h"
+
+static size_t	reader_pad(const t_gnl_reader *r)
+{
+	size_t	pending;
+
+	if (!r->align)
+		return (0);
+	pending = r->end - r->start;
+	return ((r->align - pending % r->align) % r->align);
+}
+
+static void	reader_place(t_gnl_reader *r, char *buf, size_t pad)
+{
+	size_t	pending;
+
+	pending = r->end - r->start;
+	memmove(buf + pad, r->buf + r->start, pending);
+	r->scan = r->scan - r->start + pad;
+	r->end = pad + pending;
+	r->start = pad;
+}
+
+int	gnl_reader_resize(t_gnl_reader *r, size_t cap)
+{
+	char	*bigger;
+
+	if (r->on_fill && r->on_fill(r->hook_ctx, 1) < 0)
+		return (GNL_ERROR);
+	bigger = NULL;
+	if (!r->align)
+		bigger = (char *)malloc(cap);
+	else if (posix_memalign((void **)&bigger, r->align, cap) != 0)
+		bigger = NULL;
+	if (!bigger)
+		return (GNL_ENOMEM);
+	reader_place(r, bigger, reader_pad(r));
+	free(r->buf);
+	r->buf = bigger;
+	r->cap = cap;
+	return (0);
+}
+
+int	gnl_reader_shift(t_gnl_reader *r)
+{
+	size_t	pad;
+
+	pad = reader_pad(r);
+	if (r->start <= pad)
+		return (GNL_ENOMEM);
+	reader_place(r, r->buf, pad);
+	return (0);
+}
+
+int	gnl_reader_align(t_gnl_reader *r, size_t align)
+{
+	if (r->borrowed || align < sizeof(void *) || (align & (align - 1)))
+		return (GNL_ERROR);
+	r->align = align;
+	return (gnl_reader_resize(r, (r->cap + align - 1) & ~(align - 1)));
+}
@@ -0,0 +1,38 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_reader_direct.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 19:14:26 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 19:14:26 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "gnl_direct.h"
+
+int	gnl_reader_init_direct(t_gnl_reader *r, const char *path, size_t block)
+{
+	t_gnl_source	src;
+	size_t			cap;
+	int				ret;
+
+	ret = gnl_source_direct(path, block, &src);
+	if (ret < 0)
+		return (ret);
+	cap = ((t_gnl_direct *)src.ctx)->size + GNL_BLOCK_SIZE;
+	cap = (cap + GNL_DIRECT_ALIGN - 1) & ~(size_t)(GNL_DIRECT_ALIGN - 1);
+	ret = gnl_reader_init(r, src);
+	if (ret < 0)
+	{
+		src.close(src.ctx);
+		return (GNL_ENOMEM);
+	}
+	ret = gnl_reader_align(r, GNL_DIRECT_ALIGN);
+	if (ret == 0)
+		ret = gnl_reader_resize(r, cap);
+	if (ret < 0)
+		gnl_reader_destroy(r);
+	return (ret);
+}
@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_reader_fill.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:03:05 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 15:50:02 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "gnl_reader.h"
+
+static int	reader_make_room(t_gnl_reader *r)
+{
+	int	ret;
+
+	ret = GNL_ENOMEM;
+	if (r->start == 0 || r->end - r->start > r->cap / 2)
+		ret = gnl_reader_resize(r, r->cap * 2);
+	if (ret == GNL_ENOMEM)
+		ret = gnl_reader_shift(r);
+	return (ret);
+}
+
+int	gnl_reader_fill(t_gnl_reader *r)
+{
+	ssize_t	bytes_read;
+
+	if (r->borrowed)
+		return (GNL_EOF);
+	if (r->on_fill && r->on_fill(r->hook_ctx,
+			r->start == r->end || r->end == r->cap) < 0)
+		return (GNL_ERROR);
+	if (r->start == r->end)
+	{
+		r->start = 0;
+		r->scan = 0;
+		r->end = 0;
+	}
+	if (r->end == r->cap && reader_make_room(r) < 0)
+		return (GNL_ENOMEM);
+	bytes_read = r->src.read(r->src.ctx, r->buf + r->end, r->cap - r->end);
+	if (bytes_read == GNL_AGAIN)
+		return (GNL_AGAIN);
+	if (bytes_read < 0)
+		return (GNL_ERROR);
+	r->end += bytes_read;
+	return (bytes_read > 0);
+}
+
+int	gnl_reader_seek(t_gnl_reader *r, off_t offset, size_t lines)
+{
+	if (r->borrowed && offset >= 0 && (size_t)offset <= r->cap)
+	{
+		r->start = (size_t)offset;
+		r->scan = r->start;
+	}
+	else if (r->borrowed || !r->src.seek
+		|| r->src.seek(r->src.ctx, offset) < 0)
+		return (GNL_ERROR);
+	else
+	{
+		r->start = 0;
+		r->scan = 0;
+		r->end = 0;
+	}
+	r->offset = offset;
+	r->lines = lines;
+	return (0);
+}
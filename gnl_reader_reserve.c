@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_reader_reserve.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 10:28:07 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 15:50:02 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "gnl_reader.h"
+
+int	gnl_reader_reserve(t_gnl_reader *r, size_t size)
+{
+	char	*block;
+	size_t	cap;
+	int		ret;
+
+	cap = r->cap;
+	while (!r->borrowed && cap < size)
+		cap *= 2;
+	ret = 0;
+	if (cap > r->cap)
+		ret = gnl_reader_resize(r, cap);
+	if (ret < 0)
+		return (ret);
+	block = (char *)malloc(size + 1);
+	if (!block)
+		return (GNL_ENOMEM);
+	free(r->reserve);
+	r->reserve = block;
+	r->reserve_size = size;
+	return (0);
+}
+
+static char	*reader_take_reserve(t_gnl_reader *r, size_t len)
+{
+	char	*line;
+
+	line = r->reserve;
+	if (!line || len > r->reserve_size)
+		return (NULL);
+	r->reserve = NULL;
+	return (line);
+}
+
+char	*gnl_reader_copy(t_gnl_reader *r, const t_gnl_view *view)
+{
+	char	*line;
+
+	if (r->reserve_size && !r->reserve)
+		r->reserve = (char *)malloc(r->reserve_size + 1);
+	line = (char *)malloc(view->len + 1);
+	if (!line)
+		line = reader_take_reserve(r, view->len);
+	if (!line)
+	{
+		gnl_reader_unread(r, view);
+		return (NULL);
+	}
+	memcpy(line, view->data, view->len);
+	line[view->len] = '\0';
+	return (line);
+}
+
+char	*gnl_reader_next(t_gnl_reader *r)
+{
+	t_gnl_view	view;
+
+	if (gnl_reader_next_view(r, &view) != GNL_LINE)
+		return (NULL);
+	return (gnl_reader_copy(r, &view));
+}
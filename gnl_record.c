@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_record.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:14:48 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 18:02:17 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "gnl_record.h"
+
+static size_t	record_skip(t_gnl_record *rec, const char *s, size_t len)
+{
+	const char	*quote;
+
+	if (rec->in_quotes != 1)
+		return (gnl_scan_record(s, len, rec->delim, rec->quotes));
+	quote = memchr(s, '"', len);
+	if (!quote)
+		return (len);
+	return (quote - s);
+}
+
+static void	record_quote(t_gnl_record *rec, size_t i)
+{
+	if (rec->in_quotes == 1)
+		rec->in_quotes = 2;
+	else if (rec->in_quotes == 2 || i == rec->field_start)
+		rec->in_quotes = 1;
+}
+
+static int	record_step(t_gnl_reader *r, t_gnl_record *rec, size_t *i)
+{
+	const char	*base;
+	size_t		avail;
+
+	base = r->buf + r->start;
+	avail = r->end - r->start;
+	while (1)
+	{
+		if (rec->in_quotes == 2 && *i < avail && base[*i] != '"')
+			rec->in_quotes = 0;
+		*i += record_skip(rec, base + *i, avail - *i);
+		if (*i == avail)
+			return (0);
+		if (base[*i] == '"')
+			record_quote(rec, *i);
+		else if (base[*i] == rec->delim && gnl_record_push(rec, base, *i) < 0)
+			return (GNL_ENOMEM);
+		else if (base[*i] == '\n')
+			return (1);
+		(*i)++;
+	}
+}
+
+static int	record_emit(t_gnl_reader *r, t_gnl_record *rec, size_t stop)
+{
+	const char	*base;
+	size_t		field_end;
+
+	base = r->buf + r->start;
+	field_end = stop;
+	if (field_end > rec->field_start && base[field_end - 1] == '\r')
+		field_end--;
+	if (gnl_record_push(rec, base, field_end) < 0)
+		return (GNL_ENOMEM);
+	if (stop < r->end - r->start)
+		stop++;
+	return (gnl_reader_emit(r, &rec->line, r->start + stop));
+}
+
+int	gnl_reader_next_record(t_gnl_reader *r, t_gnl_record *rec)
+{
+	size_t	i;
+	int		ret;
+
+	rec->nfields = 0;
+	rec->field_start = 0;
+	rec->in_quotes = 0;
+	i = 0;
+	ret = record_step(r, rec, &i);
+	while (ret == 0)
+	{
+		ret = gnl_reader_fill(r);
+		if (ret < 0)
+			return (ret);
+		if (ret == 0 && r->start == r->end)
+			return (GNL_EOF);
+		if (ret == 0)
+			return (record_emit(r, rec, i));
+		ret = record_step(r, rec, &i);
+	}
+	if (ret < 0)
+		return (ret);
+	return (record_emit(r, rec, i));
+}
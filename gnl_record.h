@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_record.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:10:37 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 18:02:17 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_RECORD_H
+# define GNL_RECORD_H
+
+# include "gnl_reader.h"
+
+typedef struct s_gnl_field
+{
+	size_t	start;
+	size_t	len;
+	int		quoted;
+}	t_gnl_field;
+
+typedef struct s_gnl_record
+{
+	t_gnl_view	line;
+	t_gnl_field	*fields;
+	size_t		nfields;
+	size_t		cap;
+	size_t		field_start;
+	int			in_quotes;
+	char		delim;
+	int			quotes;
+}	t_gnl_record;
+
+int		gnl_record_init(t_gnl_record *rec, char delim, int quotes);
+int		gnl_reader_next_record(t_gnl_reader *r, t_gnl_record *rec);
+int		gnl_record_push(t_gnl_record *rec, const char *base, size_t stop);
+void	gnl_record_destroy(t_gnl_record *rec);
+
+size_t	gnl_scan_record(const char *s, size_t len, char delim, int quotes);
+
+#endif //GNL_RECORD_H
@@ -0,0 +1,62 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_record_utils.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:16:20 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 18:02:17 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "gnl_record.h"
+
+int	gnl_record_init(t_gnl_record *rec, char delim, int quotes)
+{
+	rec->cap = 16;
+	rec->nfields = 0;
+	rec->delim = delim;
+	rec->quotes = quotes;
+	rec->line.data = NULL;
+	rec->line.len = 0;
+	rec->fields = (t_gnl_field *)malloc(sizeof(t_gnl_field) * rec->cap);
+	if (!rec->fields)
+		return (GNL_ERROR);
+	return (0);
+}
+
+int	gnl_record_push(t_gnl_record *rec, const char *base, size_t stop)
+{
+	t_gnl_field	*bigger;
+	t_gnl_field	*field;
+
+	if (rec->nfields == rec->cap)
+	{
+		bigger = (t_gnl_field *)malloc(sizeof(t_gnl_field) * rec->cap * 2);
+		if (!bigger)
+			return (GNL_ENOMEM);
+		memcpy(bigger, rec->fields, sizeof(t_gnl_field) * rec->nfields);
+		free(rec->fields);
+		rec->fields = bigger;
+		rec->cap *= 2;
+	}
+	field = &rec->fields[rec->nfields++];
+	field->start = rec->field_start;
+	field->len = stop - rec->field_start;
+	field->quoted = (rec->quotes && field->len >= 2
+			&& base[field->start] == '"' && base[stop - 1] == '"');
+	field->start += field->quoted;
+	field->len -= 2 * field->quoted;
+	rec->field_start = stop + 1;
+	return (0);
+}
+
+void	gnl_record_destroy(t_gnl_record *rec)
+{
+	free(rec->fields);
+	rec->fields = NULL;
+	rec->cap = 0;
+	rec->nfields = 0;
+}
@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_reverse.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:51:40 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/20 10:33:45 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include <sys/stat.h>
+#include "gnl_reverse.h"
+
+int	gnl_rreader_init(t_gnl_rreader *r, int fd)
+{
+	struct stat	st;
+
+	if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode))
+		return (GNL_ERROR);
+	r->fd = fd;
+	r->pos = st.st_size;
+	r->cap = GNL_BLOCK_SIZE;
+	r->lo = r->cap;
+	r->scan = r->cap;
+	r->end = r->cap;
+	r->buf = (char *)malloc(r->cap);
+	if (!r->buf)
+		return (GNL_ERROR);
+	return (0);
+}
+
+static int	rreader_find(t_gnl_rreader *r, size_t *nl)
+{
+	size_t	i;
+
+	i = r->scan;
+	if (i == r->end && i > r->lo)
+		i--;
+	while (i > r->lo)
+	{
+		if (r->buf[i - 1] == '\n')
+		{
+			*nl = i - 1;
+			return (1);
+		}
+		i--;
+	}
+	r->scan = r->lo;
+	return (0);
+}
+
+int	gnl_rreader_next_view(t_gnl_rreader *r, t_gnl_view *line)
+{
+	size_t	nl;
+
+	if (r->end == r->lo && r->pos == 0)
+		return (GNL_EOF);
+	while (!rreader_find(r, &nl))
+	{
+		if (r->pos == 0)
+		{
+			line->data = r->buf + r->lo;
+			line->len = r->end - r->lo;
+			r->end = r->lo;
+			return (GNL_LINE);
+		}
+		if (gnl_rreader_prepend(r) < 0)
+			return (GNL_ERROR);
+	}
+	line->data = r->buf + nl + 1;
+	line->len = r->end - nl - 1;
+	r->end = nl + 1;
+	r->scan = r->end;
+	return (GNL_LINE);
+}
+
+char	*gnl_rreader_next(t_gnl_rreader *r)
+{
+	t_gnl_view	view;
+	char		*line;
+
+	if (gnl_rreader_next_view(r, &view) != GNL_LINE)
+		return (NULL);
+	line = (char *)malloc(view.len + 1);
+	if (!line)
+	{
+		r->end += view.len;
+		r->scan = r->end;
+		return (NULL);
+	}
+	memcpy(line, view.data, view.len);
+	line[view.len] = '\0';
+	return (line);
+}
+
+void	gnl_rreader_destroy(t_gnl_rreader *r)
+{
+	free(r->buf);
+	r->buf = NULL;
+	r->cap = 0;
+	r->lo = 0;
+	r->scan = 0;
+	r->end = 0;
+}
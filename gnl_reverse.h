@@ -0,0 +1,36 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_reverse.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:48:22 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/19 13:48:22 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_REVERSE_H
+# define GNL_REVERSE_H
+
+# include "gnl_reader.h"
+
+typedef struct s_gnl_rreader
+{
+	int		fd;
+	char	*buf;
+	size_t	cap;
+	size_t	lo;
+	size_t	scan;
+	size_t	end;
+	off_t	pos;
+}	t_gnl_rreader;
+
+int		gnl_rreader_init(t_gnl_rreader *r, int fd);
+int		gnl_rreader_next_view(t_gnl_rreader *r, t_gnl_view *line);
+char	*gnl_rreader_next(t_gnl_rreader *r);
+void	gnl_rreader_destroy(t_gnl_rreader *r);
+
+int		gnl_rreader_prepend(t_gnl_rreader *r);
+
+#endif //GNL_REVERSE_H
@@ -0,0 +1,64 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_reverse_fill.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:58:03 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/19 13:58:03 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include <unistd.h>
+#include "gnl_reverse.h"
+
+static void	rreader_shift(t_gnl_rreader *r, char *dst, size_t new_lo)
+{
+	memmove(dst + new_lo, r->buf + r->lo, r->end - r->lo);
+	r->scan = r->scan - r->lo + new_lo;
+	r->end = r->end - r->lo + new_lo;
+	r->lo = new_lo;
+}
+
+static int	rreader_make_room(t_gnl_rreader *r, size_t chunk)
+{
+	size_t	pending;
+	size_t	new_cap;
+	char	*bigger;
+
+	pending = r->end - r->lo;
+	if (r->cap - pending >= chunk)
+	{
+		rreader_shift(r, r->buf, r->cap - pending);
+		return (0);
+	}
+	new_cap = r->cap * 2;
+	while (new_cap - pending < chunk)
+		new_cap *= 2;
+	bigger = (char *)malloc(new_cap);
+	if (!bigger)
+		return (GNL_ERROR);
+	rreader_shift(r, bigger, new_cap - pending);
+	free(r->buf);
+	r->buf = bigger;
+	r->cap = new_cap;
+	return (0);
+}
+
+int	gnl_rreader_prepend(t_gnl_rreader *r)
+{
+	size_t	chunk;
+
+	chunk = GNL_BLOCK_SIZE;
+	if ((off_t)chunk > r->pos)
+		chunk = (size_t)r->pos;
+	if (r->lo < chunk && rreader_make_room(r, chunk) < 0)
+		return (GNL_ERROR);
+	if (gnl_pread_all(r->fd, r->buf + r->lo - chunk, chunk, r->pos - chunk) < 0)
+		return (GNL_ERROR);
+	r->lo -= chunk;
+	r->pos -= chunk;
+	return (0);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_ring.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:11:08 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 10:43:22 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include "gnl_pipeline.h"
+
+int	gnl_ring_init(t_gnl_ring *q, size_t size)
+{
+	size_t	i;
+
+	q->mask = 1;
+	while (q->mask < size)
+		q->mask <<= 1;
+	q->cells = NULL;
+	if (posix_memalign((void **)&q->cells, GNL_CACHE_LINE,
+			sizeof(t_gnl_cell) * q->mask) != 0)
+		return (GNL_ERROR);
+	i = 0;
+	while (i < q->mask)
+	{
+		atomic_init(&q->cells[i].seq, i);
+		i++;
+	}
+	q->mask--;
+	atomic_init(&q->head, 0);
+	atomic_init(&q->tail, 0);
+	atomic_init(&q->waiters, 0);
+	pthread_mutex_init(&q->lock, NULL);
+	pthread_cond_init(&q->wake, NULL);
+	return (0);
+}
+
+int	gnl_ring_push(t_gnl_ring *q, const t_gnl_item *item)
+{
+	t_gnl_cell	*cell;
+	size_t		pos;
+	intptr_t	diff;
+
+	pos = atomic_load_explicit(&q->tail, memory_order_relaxed);
+	while (1)
+	{
+		cell = &q->cells[pos & q->mask];
+		diff = (intptr_t)atomic_load_explicit(&cell->seq,
+				memory_order_acquire) - (intptr_t)pos;
+		if (diff < 0)
+			return (0);
+		if (diff == 0 && atomic_compare_exchange_weak_explicit(&q->tail,
+				&pos, pos + 1, memory_order_relaxed, memory_order_relaxed))
+			break ;
+		if (diff > 0)
+			pos = atomic_load_explicit(&q->tail, memory_order_relaxed);
+	}
+	cell->item = *item;
+	atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+	return (1);
+}
+
+int	gnl_ring_pop(t_gnl_ring *q, t_gnl_item *item)
+{
+	t_gnl_cell	*cell;
+	size_t		pos;
+	intptr_t	diff;
+
+	pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+	while (1)
+	{
+		cell = &q->cells[pos & q->mask];
+		diff = (intptr_t)atomic_load_explicit(&cell->seq,
+				memory_order_acquire) - (intptr_t)(pos + 1);
+		if (diff < 0)
+			return (0);
+		if (diff == 0 && atomic_compare_exchange_weak_explicit(&q->head,
+				&pos, pos + 1, memory_order_relaxed, memory_order_relaxed))
+			break ;
+		if (diff > 0)
+			pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+	}
+	*item = cell->item;
+	atomic_store_explicit(&cell->seq, pos + q->mask + 1,
+		memory_order_release);
+	return (1);
+}
+
+void	gnl_ring_destroy(t_gnl_ring *q)
+{
+	if (!q->cells)
+		return ;
+	pthread_cond_destroy(&q->wake);
+	pthread_mutex_destroy(&q->lock);
+	free(q->cells);
+	q->cells = NULL;
+	q->mask = 0;
+}
+
+void	gnl_ring_wake(t_gnl_ring *q)
+{
+	atomic_thread_fence(memory_order_seq_cst);
+	if (atomic_load_explicit(&q->waiters, memory_order_relaxed) == 0)
+		return ;
+	pthread_mutex_lock(&q->lock);
+	pthread_cond_broadcast(&q->wake);
+	pthread_mutex_unlock(&q->lock);
+}
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_ring_wait.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 10:46:54 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 10:46:54 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <sched.h>
+#include "gnl_pipeline.h"
+
+static int	ring_try(t_gnl_ring *q, const t_gnl_item *in, t_gnl_item *out)
+{
+	if (in)
+		return (gnl_ring_push(q, in));
+	return (gnl_ring_pop(q, out));
+}
+
+static int	ring_park(t_gnl_ring *q, const t_gnl_item *in, t_gnl_item *out,
+		atomic_int *done)
+{
+	int	ok;
+
+	pthread_mutex_lock(&q->lock);
+	atomic_fetch_add(&q->waiters, 1);
+	atomic_thread_fence(memory_order_seq_cst);
+	ok = ring_try(q, in, out);
+	if (!ok && !(done && atomic_load_explicit(done, memory_order_acquire)))
+		pthread_cond_wait(&q->wake, &q->lock);
+	atomic_fetch_sub(&q->waiters, 1);
+	pthread_mutex_unlock(&q->lock);
+	return (ok);
+}
+
+static int	ring_wait(t_gnl_ring *q, const t_gnl_item *in, t_gnl_item *out,
+		atomic_int *done)
+{
+	size_t	spins;
+	int		ok;
+
+	spins = 0;
+	ok = ring_try(q, in, out);
+	while (!ok && !(done && atomic_load_explicit(done, memory_order_acquire)))
+	{
+		if (spins++ < GNL_SPIN_LIMIT)
+			sched_yield();
+		else
+			ok = ring_park(q, in, out, done);
+		if (!ok)
+			ok = ring_try(q, in, out);
+	}
+	if (!ok)
+		ok = ring_try(q, in, out);
+	if (ok)
+		gnl_ring_wake(q);
+	return (ok);
+}
+
+int	gnl_ring_push_wait(t_gnl_ring *q, const t_gnl_item *item)
+{
+	return (ring_wait(q, item, NULL, NULL));
+}
+
+int	gnl_ring_pop_wait(t_gnl_ring *q, t_gnl_item *item, atomic_int *done)
+{
+	return (ring_wait(q, NULL, item, done));
+}
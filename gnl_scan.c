@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_scan.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:12:05 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/19 12:12:05 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <string.h>
+#include "gnl_record.h"
+
+static uint64_t	has_byte(uint64_t word, unsigned char c)
+{
+	uint64_t	x;
+
+	x = word ^ (GNL_ONES * c);
+	return ((x - GNL_ONES) & ~x & GNL_HIGHS);
+}
+
+static int	is_stop(char c, char delim, int quotes)
+{
+	return (c == '\n' || c == delim || (quotes && c == '"'));
+}
+
+size_t	gnl_scan_record(const char *s, size_t len, char delim, int quotes)
+{
+	size_t		i;
+	uint64_t	word;
+	uint64_t	hits;
+
+	i = 0;
+	while (i + 8 <= len)
+	{
+		memcpy(&word, s + i, 8);
+		hits = has_byte(word, '\n') | has_byte(word, (unsigned char)delim);
+		if (quotes)
+			hits |= has_byte(word, '"');
+		if (hits)
+			break ;
+		i += 8;
+	}
+	while (i < len && !is_stop(s[i], delim, quotes))
+		i++;
+	return (i);
+}
@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_scanner.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:45:30 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 11:24:02 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <fcntl.h>
+#include <unistd.h>
+#include "gnl_scanner.h"
+
+static int	scanner_lines(t_gnl_scanner *s, t_gnl_reader *r,
+		const t_gnl_task *task)
+{
+	t_gnl_view	line;
+	int			ret;
+
+	ret = GNL_LINE;
+	if (task->begin > 0)
+		ret = gnl_reader_next_view(r, &line);
+	while (ret == GNL_LINE && r->offset < task->end
+		&& !atomic_load_explicit(&s->abort, memory_order_relaxed))
+	{
+		ret = gnl_reader_next_view(r, &line);
+		if (ret == GNL_LINE && s->cfg.on_line(s->cfg.ctx, task->file,
+				&line) < 0)
+			atomic_store(&s->abort, 1);
+	}
+	if (ret < 0)
+		return (ret);
+	return (0);
+}
+
+static int	scanner_run(t_gnl_scanner *s, const t_gnl_task *task)
+{
+	t_gnl_source	src;
+	t_gnl_reader	reader;
+	off_t			from;
+	int				fd;
+	int				ret;
+
+	fd = open(s->paths[task->file], O_RDONLY);
+	if (fd < 0)
+		return (GNL_ERROR);
+	from = task->begin - (task->begin > 0);
+	ret = gnl_source_pread(fd, from, &src);
+	if (ret == 0)
+	{
+		ret = gnl_reader_init(&reader, src);
+		if (ret == 0)
+			ret = gnl_reader_seek(&reader, from, 0);
+		if (ret == 0)
+			ret = scanner_lines(s, &reader, task);
+		gnl_reader_destroy(&reader);
+	}
+	close(fd);
+	return (ret);
+}
+
+static int	scanner_next(t_gnl_worker *w, t_gnl_task *task)
+{
+	t_gnl_scanner	*s;
+	size_t			i;
+	int				contended;
+	int				ret;
+
+	s = w->scanner;
+	if (gnl_deque_take(&w->deque, task))
+		return (1);
+	contended = 1;
+	while (contended)
+	{
+		contended = 0;
+		i = 1;
+		while (i < s->cfg.nthreads)
+		{
+			ret = gnl_deque_steal(
+					&s->workers[(w->id + i++) % s->cfg.nthreads].deque, task);
+			if (ret > 0)
+				return (1);
+			contended |= (ret < 0);
+		}
+	}
+	return (0);
+}
+
+static void	*scanner_work(void *arg)
+{
+	t_gnl_worker	*w;
+	t_gnl_task		task;
+
+	w = (t_gnl_worker *)arg;
+	while (!atomic_load_explicit(&w->scanner->abort, memory_order_relaxed)
+		&& scanner_next(w, &task))
+	{
+		if (scanner_run(w->scanner, &task) < 0)
+			atomic_store(&w->scanner->failed, 1);
+	}
+	return (NULL);
+}
+
+int	gnl_scan_files(const char **paths, size_t count,
+		const t_gnl_scan_cfg *cfg)
+{
+	t_gnl_scanner	s;
+	size_t			i;
+
+	s.paths = paths;
+	s.count = count;
+	s.cfg = *cfg;
+	if (s.cfg.chunk_size <= 0)
+		s.cfg.chunk_size = GNL_CHUNK_SIZE;
+	atomic_init(&s.failed, 0);
+	atomic_init(&s.abort, 0);
+	if (gnl_scanner_plan(&s) < 0)
+		return (GNL_ERROR);
+	i = 0;
+	while (i < s.cfg.nthreads && pthread_create(&s.workers[i].thread, NULL,
+			scanner_work, &s.workers[i]) == 0)
+		i++;
+	if (i < s.cfg.nthreads)
+		atomic_store(&s.abort, 1);
+	while (i > 0)
+		pthread_join(s.workers[--i].thread, NULL);
+	gnl_scanner_free(&s);
+	if (atomic_load(&s.failed) || atomic_load(&s.abort))
+		return (GNL_ERROR);
+	return (0);
+}
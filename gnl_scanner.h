@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_scanner.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:20:04 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 11:22:48 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_SCANNER_H
+# define GNL_SCANNER_H
+
+# include <pthread.h>
+# include <stdatomic.h>
+# include "gnl_reader.h"
+
+# ifndef GNL_CHUNK_SIZE
+#  define GNL_CHUNK_SIZE 67108864
+# endif
+
+typedef int	(*t_gnl_line_fn)(void *ctx, size_t file, const t_gnl_view *line);
+
+typedef struct s_gnl_scan_cfg
+{
+	size_t			nthreads;
+	off_t			chunk_size;
+	t_gnl_line_fn	on_line;
+	void			*ctx;
+}	t_gnl_scan_cfg;
+
+typedef struct s_gnl_task
+{
+	size_t	file;
+	off_t	begin;
+	off_t	end;
+}	t_gnl_task;
+
+typedef struct s_gnl_deque
+{
+	atomic_llong	top;
+	char			pad_top[GNL_CACHE_LINE - sizeof(atomic_llong)];
+	atomic_llong	bottom;
+	char			pad_bottom[GNL_CACHE_LINE - sizeof(atomic_llong)];
+	t_gnl_task		*tasks;
+	long long		cap;
+}	t_gnl_deque;
+
+typedef struct s_gnl_worker
+{
+	struct s_gnl_scanner	*scanner;
+	size_t					id;
+	pthread_t				thread;
+	t_gnl_deque				deque;
+}	t_gnl_worker;
+
+typedef struct s_gnl_scanner
+{
+	const char		**paths;
+	size_t			count;
+	t_gnl_scan_cfg	cfg;
+	t_gnl_worker	*workers;
+	atomic_int		failed;
+	atomic_int		abort;
+}	t_gnl_scanner;
+
+int		gnl_deque_init(t_gnl_deque *d, size_t cap);
+int		gnl_deque_push(t_gnl_deque *d, const t_gnl_task *task);
+int		gnl_deque_take(t_gnl_deque *d, t_gnl_task *task);
+int		gnl_deque_steal(t_gnl_deque *d, t_gnl_task *task);
+void	gnl_deque_destroy(t_gnl_deque *d);
+
+int		gnl_scanner_plan(t_gnl_scanner *s);
+void	gnl_scanner_free(t_gnl_scanner *s);
+int		gnl_scan_files(const char **paths, size_t count,
+			const t_gnl_scan_cfg *cfg);
+
+#endif //GNL_SCANNER_H
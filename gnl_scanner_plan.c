@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_scanner_plan.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:34:12 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 11:20:36 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <sys/stat.h>
+#include <unistd.h>
+#include "gnl_scanner.h"
+
+static size_t	scanner_sizes(t_gnl_scanner *s, off_t *sizes)
+{
+	struct stat	st;
+	size_t		total;
+	size_t		i;
+
+	total = 0;
+	i = 0;
+	while (i < s->count)
+	{
+		sizes[i] = 0;
+		if (stat(s->paths[i], &st) < 0 || !S_ISREG(st.st_mode))
+			atomic_store(&s->failed, 1);
+		else
+			sizes[i] = st.st_size;
+		total += (sizes[i] + s->cfg.chunk_size - 1) / s->cfg.chunk_size;
+		i++;
+	}
+	return (total);
+}
+
+static int	scanner_alloc(t_gnl_scanner *s, size_t total)
+{
+	size_t	i;
+
+	s->workers = (t_gnl_worker *)malloc(sizeof(t_gnl_worker)
+			* s->cfg.nthreads);
+	if (!s->workers)
+		return (GNL_ERROR);
+	i = 0;
+	while (i < s->cfg.nthreads)
+	{
+		s->workers[i].scanner = s;
+		s->workers[i].id = i;
+		if (gnl_deque_init(&s->workers[i].deque,
+				total / s->cfg.nthreads + 1) < 0)
+		{
+			while (i > 0)
+				gnl_deque_destroy(&s->workers[--i].deque);
+			free(s->workers);
+			s->workers = NULL;
+			return (GNL_ERROR);
+		}
+		i++;
+	}
+	return (0);
+}
+
+static int	scanner_split(t_gnl_scanner *s, size_t file, off_t size,
+		size_t *next)
+{
+	t_gnl_task	task;
+
+	task.file = file;
+	task.begin = 0;
+	while (task.begin < size)
+	{
+		task.end = task.begin + s->cfg.chunk_size;
+		if (task.end > size)
+			task.end = size;
+		if (!gnl_deque_push(&s->workers[*next % s->cfg.nthreads].deque,
+				&task))
+			return (GNL_ERROR);
+		(*next)++;
+		task.begin = task.end;
+	}
+	return (0);
+}
+
+int	gnl_scanner_plan(t_gnl_scanner *s)
+{
+	off_t	*sizes;
+	size_t	next;
+	size_t	i;
+	int		ret;
+
+	if (s->cfg.nthreads == 0)
+		s->cfg.nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+	if ((long)s->cfg.nthreads < 1)
+		s->cfg.nthreads = 1;
+	sizes = (off_t *)malloc(sizeof(off_t) * (s->count + 1));
+	if (!sizes)
+		return (GNL_ERROR);
+	ret = scanner_alloc(s, scanner_sizes(s, sizes));
+	next = 0;
+	i = 0;
+	while (ret == 0 && i < s->count)
+	{
+		ret = scanner_split(s, i, sizes[i], &next);
+		i++;
+	}
+	free(sizes);
+	if (ret < 0 && s->workers)
+		gnl_scanner_free(s);
+	return (ret);
+}
+
+void	gnl_scanner_free(t_gnl_scanner *s)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < s->cfg.nthreads)
+		gnl_deque_destroy(&s->workers[i++].deque);
+	free(s->workers);
+	s->workers = NULL;
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_source_direct.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 13:55:09 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 19:14:26 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _GNU_SOURCE
+# define _GNU_SOURCE
+#endif
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include "gnl_direct.h"
+
+static ssize_t	direct_refill(t_gnl_direct *d)
+{
+	ssize_t	got;
+
+	got = gnl_direct_pread(d, d->block, d->size);
+	if (got <= 0)
+		return (got);
+	d->tail = (size_t)got;
+	d->head = d->skip;
+	if (d->head > d->tail)
+		d->head = d->tail;
+	d->skip = 0;
+	return (got);
+}
+
+static ssize_t	direct_read(void *ctx, char *dst, size_t size)
+{
+	t_gnl_direct	*d;
+	ssize_t			got;
+	int				aligned;
+
+	d = (t_gnl_direct *)ctx;
+	aligned = ((uintptr_t)dst % GNL_DIRECT_ALIGN == 0
+			&& d->pos % GNL_DIRECT_ALIGN == 0 && size >= d->size);
+	if (d->head == d->tail && d->skip == 0 && (aligned || !d->direct))
+	{
+		if (d->direct)
+			size &= ~(size_t)(GNL_DIRECT_ALIGN - 1);
+		return (gnl_direct_pread(d, dst, size));
+	}
+	while (d->head == d->tail)
+	{
+		got = direct_refill(d);
+		if (got <= 0)
+			return (got);
+	}
+	if (size > d->tail - d->head)
+		size = d->tail - d->head;
+	memcpy(dst, d->block + d->head, size);
+	d->head += size;
+	return ((ssize_t)size);
+}
+
+static int	direct_seek(void *ctx, off_t offset)
+{
+	t_gnl_direct	*d;
+
+	if (offset < 0)
+		return (GNL_ERROR);
+	d = (t_gnl_direct *)ctx;
+	d->pos = offset & ~(off_t)(GNL_DIRECT_ALIGN - 1);
+	d->skip = (size_t)(offset - d->pos);
+	d->head = 0;
+	d->tail = 0;
+	return (0);
+}
+
+static void	direct_close(void *ctx)
+{
+	t_gnl_direct	*d;
+
+	d = (t_gnl_direct *)ctx;
+	if (d->block)
+		munmap(d->block, d->mapped);
+	if (d->fd >= 0)
+		close(d->fd);
+	free(d);
+}
+
+int	gnl_source_direct(const char *path, size_t block, t_gnl_source *out)
+{
+	t_gnl_direct	*d;
+
+	d = (t_gnl_direct *)calloc(1, sizeof(t_gnl_direct));
+	if (!d)
+		return (GNL_ENOMEM);
+	if (block == 0)
+		block = GNL_DIRECT_BLOCK;
+	d->size = (block + GNL_DIRECT_ALIGN - 1) & ~(size_t)(GNL_DIRECT_ALIGN - 1);
+	d->block = gnl_direct_alloc(d->size, &d->mapped);
+	d->fd = gnl_direct_open(path, &d->direct);
+	if (!d->block || d->fd < 0)
+	{
+		direct_close(d);
+		return (GNL_ERROR);
+	}
+	out->read = direct_read;
+	out->close = direct_close;
+	out->seek = direct_seek;
+	out->ctx = d;
+	return (0);
+}
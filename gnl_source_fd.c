@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_source_fd.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:03:40 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 15:05:12 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <errno.h>
+#include <stdint.h>
+#include <unistd.h>
+#include "gnl_reader.h"
+
+static ssize_t	fd_read(void *ctx, char *dst, size_t size)
+{
+	ssize_t	bytes_read;
+
+	bytes_read = read((int)(intptr_t)ctx, dst, size);
+	if (bytes_read < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+		return (GNL_AGAIN);
+	return (bytes_read);
+}
+
+static int	fd_seek(void *ctx, off_t offset)
+{
+	if (lseek((int)(intptr_t)ctx, offset, SEEK_SET) < 0)
+		return (GNL_ERROR);
+	return (0);
+}
+
+t_gnl_source	gnl_source_fd(int fd)
+{
+	t_gnl_source	src;
+
+	src.read = fd_read;
+	src.close = NULL;
+	src.seek = fd_seek;
+	src.ctx = (void *)(intptr_t)fd;
+	return (src);
+}
@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_source_file.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:34:02 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/19 11:34:02 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "gnl_reader.h"
+
+static ssize_t	file_read(void *ctx, char *dst, size_t size)
+{
+	size_t	bytes_read;
+
+	bytes_read = fread(dst, 1, size, (FILE *)ctx);
+	if (bytes_read == 0 && ferror((FILE *)ctx))
+		return (GNL_ERROR);
+	return ((ssize_t)bytes_read);
+}
+
+static int	file_seek(void *ctx, off_t offset)
+{
+	if (fseeko((FILE *)ctx, offset, SEEK_SET) < 0)
+		return (GNL_ERROR);
+	return (0);
+}
+
+t_gnl_source	gnl_source_file(FILE *file)
+{
+	t_gnl_source	src;
+
+	src.read = file_read;
+	src.close = NULL;
+	src.seek = file_seek;
+	src.ctx = file;
+	return (src);
+}
+
+t_gnl_source	gnl_source_callback(t_gnl_read_fn read, void *ctx)
+{
+	t_gnl_source	src;
+
+	src.read = read;
+	src.close = NULL;
+	src.seek = NULL;
+	src.ctx = ctx;
+	return (src);
+}
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_source_gzip.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:05:12 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 09:14:05 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <limits.h>
+#include <unistd.h>
+#include "gnl_codec.h"
+
+static int	gzip_refill(t_gnl_gzip *z)
+{
+	ssize_t	bytes_read;
+
+	bytes_read = read(z->fd, z->in, GNL_BLOCK_SIZE);
+	if (bytes_read < 0)
+		return (GNL_ERROR);
+	if (bytes_read == 0)
+		z->done = 1;
+	z->zs.next_in = z->in;
+	z->zs.avail_in = (uInt)bytes_read;
+	return (0);
+}
+
+static int	gzip_next_member(t_gnl_gzip *z)
+{
+	if (z->zs.avail_in == 0 && !z->done && gzip_refill(z) < 0)
+		return (Z_ERRNO);
+	if (z->zs.avail_in == 0)
+		return (Z_OK);
+	z->ended = 0;
+	return (inflateReset(&z->zs));
+}
+
+static ssize_t	gzip_read(void *ctx, char *dst, size_t size)
+{
+	t_gnl_gzip	*z;
+	int			ret;
+
+	z = (t_gnl_gzip *)ctx;
+	if (size > UINT_MAX)
+		size = UINT_MAX;
+	z->zs.next_out = (Bytef *)dst;
+	z->zs.avail_out = (uInt)size;
+	while (z->zs.avail_out == size)
+	{
+		if (z->zs.avail_in == 0 && !z->done && gzip_refill(z) < 0)
+			return (GNL_ERROR);
+		ret = inflate(&z->zs, Z_NO_FLUSH);
+		z->ended |= (ret == Z_STREAM_END);
+		if (ret == Z_STREAM_END)
+			ret = gzip_next_member(z);
+		if (ret != Z_OK && ret != Z_BUF_ERROR)
+			return (GNL_ERROR);
+		if (z->done && z->zs.avail_out == size && !z->ended)
+			return (GNL_ERROR);
+		if (z->done && z->zs.avail_out == size)
+			break ;
+	}
+	return (size - z->zs.avail_out);
+}
+
+static void	gzip_close(void *ctx)
+{
+	inflateEnd(&((t_gnl_gzip *)ctx)->zs);
+	free(ctx);
+}
+
+int	gnl_source_gzip(int fd, t_gnl_source *out)
+{
+	t_gnl_gzip	*z;
+
+	z = (t_gnl_gzip *)malloc(sizeof(t_gnl_gzip));
+	if (!z)
+		return (GNL_ERROR);
+	z->fd = fd;
+	z->done = 0;
+	z->ended = 0;
+	z->zs.zalloc = Z_NULL;
+	z->zs.zfree = Z_NULL;
+	z->zs.opaque = Z_NULL;
+	z->zs.next_in = z->in;
+	z->zs.avail_in = 0;
+	if (inflateInit2(&z->zs, 15 + 32) != Z_OK)
+	{
+		free(z);
+		return (GNL_ERROR);
+	}
+	out->read = gzip_read;
+	out->close = gzip_close;
+	out->seek = NULL;
+	out->ctx = z;
+	return (0);
+}
@@ -0,0 +1,42 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_source_mem.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:31:50 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 15:50:02 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "gnl_reader.h"
+
+static ssize_t	mem_read(void *ctx, char *dst, size_t size)
+{
+	(void)ctx;
+	(void)dst;
+	(void)size;
+	return (0);
+}
+
+void	gnl_reader_init_mem(t_gnl_reader *r, const char *data, size_t len)
+{
+	r->src.read = mem_read;
+	r->src.close = NULL;
+	r->src.seek = NULL;
+	r->src.ctx = NULL;
+	r->buf = (char *)data;
+	r->cap = len;
+	r->start = 0;
+	r->scan = 0;
+	r->end = len;
+	r->borrowed = 1;
+	r->align = 0;
+	r->offset = 0;
+	r->lines = 0;
+	r->on_fill = NULL;
+	r->hook_ctx = NULL;
+	r->reserve = NULL;
+	r->reserve_size = 0;
+}
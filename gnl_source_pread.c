@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_source_pread.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:02:44 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/19 13:02:44 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <unistd.h>
+#include "gnl_reader.h"
+
+static ssize_t	pread_read(void *ctx, char *dst, size_t size)
+{
+	t_gnl_pread	*p;
+	ssize_t		bytes_read;
+
+	p = (t_gnl_pread *)ctx;
+	bytes_read = pread(p->fd, dst, size, p->pos);
+	if (bytes_read > 0)
+		p->pos += bytes_read;
+	return (bytes_read);
+}
+
+static int	pread_seek(void *ctx, off_t offset)
+{
+	if (offset < 0)
+		return (GNL_ERROR);
+	((t_gnl_pread *)ctx)->pos = offset;
+	return (0);
+}
+
+static void	pread_close(void *ctx)
+{
+	free(ctx);
+}
+
+int	gnl_source_pread(int fd, off_t offset, t_gnl_source *out)
+{
+	t_gnl_pread	*p;
+
+	p = (t_gnl_pread *)malloc(sizeof(t_gnl_pread));
+	if (!p)
+		return (GNL_ERROR);
+	p->fd = fd;
+	p->pos = offset;
+	out->read = pread_read;
+	out->close = pread_close;
+	out->seek = pread_seek;
+	out->ctx = p;
+	return (0);
+}
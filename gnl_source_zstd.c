@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_source_zstd.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:07:26 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 09:16:22 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <unistd.h>
+#include "gnl_codec.h"
+
+#ifdef GNL_ZSTD
+
+static int	zstd_refill(t_gnl_zstd *z)
+{
+	ssize_t	bytes_read;
+
+	bytes_read = read(z->fd, z->block, GNL_BLOCK_SIZE);
+	if (bytes_read < 0)
+		return (GNL_ERROR);
+	if (bytes_read == 0)
+		z->done = 1;
+	z->in.src = z->block;
+	z->in.size = (size_t)bytes_read;
+	z->in.pos = 0;
+	return (0);
+}
+
+static ssize_t	zstd_read(void *ctx, char *dst, size_t size)
+{
+	t_gnl_zstd		*z;
+	ZSTD_outBuffer	out;
+	size_t			ret;
+	size_t			consumed;
+
+	z = (t_gnl_zstd *)ctx;
+	out.dst = dst;
+	out.size = size;
+	out.pos = 0;
+	while (out.pos == 0)
+	{
+		if (z->in.pos == z->in.size && !z->done && zstd_refill(z) < 0)
+			return (GNL_ERROR);
+		consumed = z->in.pos;
+		ret = ZSTD_decompressStream(z->ds, &out, &z->in);
+		if (ZSTD_isError(ret))
+			return (GNL_ERROR);
+		if (z->in.pos != consumed || out.pos > 0)
+			z->pending = ret;
+		if (z->done && out.pos == 0 && z->pending != 0)
+			return (GNL_ERROR);
+		if (z->done && out.pos == 0)
+			break ;
+	}
+	return ((ssize_t)out.pos);
+}
+
+static void	zstd_close(void *ctx)
+{
+	ZSTD_freeDStream(((t_gnl_zstd *)ctx)->ds);
+	free(ctx);
+}
+
+int	gnl_source_zstd(int fd, t_gnl_source *out)
+{
+	t_gnl_zstd	*z;
+
+	z = (t_gnl_zstd *)malloc(sizeof(t_gnl_zstd));
+	if (!z)
+		return (GNL_ERROR);
+	z->ds = ZSTD_createDStream();
+	if (!z->ds || ZSTD_isError(ZSTD_initDStream(z->ds)))
+	{
+		ZSTD_freeDStream(z->ds);
+		free(z);
+		return (GNL_ERROR);
+	}
+	z->fd = fd;
+	z->done = 0;
+	z->pending = 1;
+	z->in.src = z->block;
+	z->in.size = 0;
+	z->in.pos = 0;
+	out->read = zstd_read;
+	out->close = zstd_close;
+	out->seek = NULL;
+	out->ctx = z;
+	return (0);
+}
+
+#else
+
+int	gnl_source_zstd(int fd, t_gnl_source *out)
+{
+	(void)fd;
+	(void)out;
+	return (GNL_ERROR);
+}
+
+#endif
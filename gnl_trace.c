@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_trace.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 11:05:51 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/20 11:38:40 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "gnl_trace.h"
+
+#ifdef GNL_TRACE
+
+static ssize_t	trace_read(void *ctx, char *dst, size_t size)
+{
+	t_gnl_trace	*t;
+	uint64_t	since;
+	uint64_t	ns;
+	ssize_t		ret;
+
+	t = (t_gnl_trace *)ctx;
+	since = gnl_trace_now();
+	ret = t->inner.read(t->inner.ctx, dst, size);
+	ns = gnl_trace_now() - since;
+	t->waited += ns;
+	gnl_trace_record(t, GNL_TRACE_WAIT, ns);
+	return (ret);
+}
+
+static void	trace_close(void *ctx)
+{
+	t_gnl_trace	*t;
+
+	t = (t_gnl_trace *)ctx;
+	if (t->inner.close)
+		t->inner.close(t->inner.ctx);
+}
+
+static int	trace_seek(void *ctx, off_t offset)
+{
+	t_gnl_trace	*t;
+
+	t = (t_gnl_trace *)ctx;
+	return (t->inner.seek(t->inner.ctx, offset));
+}
+
+void	gnl_trace_attach(t_gnl_trace *t, t_gnl_reader *r)
+{
+	memset(t, 0, sizeof(t_gnl_trace));
+	t->inner = r->src;
+	r->src.read = trace_read;
+	r->src.close = trace_close;
+	r->src.seek = NULL;
+	if (t->inner.seek)
+		r->src.seek = trace_seek;
+	r->src.ctx = t;
+}
+
+void	gnl_trace_record(t_gnl_trace *t, int phase, uint64_t ns)
+{
+	t_gnl_hist	*h;
+	uint64_t	idx;
+	int			e;
+
+	h = &t->hist[phase];
+	idx = ns;
+	if (ns >= GNL_HIST_SUB)
+	{
+		e = 63 - __builtin_clzll(ns);
+		idx = ((uint64_t)(e - GNL_HIST_SUB_BITS + 1) << GNL_HIST_SUB_BITS)
+			+ ((ns >> (e - GNL_HIST_SUB_BITS)) & (GNL_HIST_SUB - 1));
+	}
+	h->counts[idx]++;
+	if (h->count == 0 || ns < h->min)
+		h->min = ns;
+	if (ns > h->max)
+		h->max = ns;
+	h->count++;
+	h->sum += ns;
+}
+
+#endif
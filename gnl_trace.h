@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_trace.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 11:02:37 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/20 11:40:12 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_TRACE_H
+# define GNL_TRACE_H
+
+# include "gnl_reader.h"
+
+# ifdef GNL_TRACE
+
+#  include <stdint.h>
+
+#  ifndef GNL_HIST_SUB_BITS
+#   define GNL_HIST_SUB_BITS 4
+#  endif
+
+#  define GNL_HIST_SUB (1 << GNL_HIST_SUB_BITS)
+#  define GNL_HIST_BUCKETS ((65 - GNL_HIST_SUB_BITS) << GNL_HIST_SUB_BITS)
+
+#  define GNL_TRACE_WAIT 0
+#  define GNL_TRACE_SCAN 1
+#  define GNL_TRACE_COPY 2
+#  define GNL_TRACE_PHASES 3
+
+typedef struct s_gnl_hist
+{
+	uint64_t	counts[GNL_HIST_BUCKETS];
+	uint64_t	count;
+	uint64_t	sum;
+	uint64_t	min;
+	uint64_t	max;
+}	t_gnl_hist;
+
+typedef struct s_gnl_trace
+{
+	t_gnl_source	inner;
+	uint64_t		waited;
+	t_gnl_hist		hist[GNL_TRACE_PHASES];
+}	t_gnl_trace;
+
+void		gnl_trace_attach(t_gnl_trace *t, t_gnl_reader *r);
+void		gnl_trace_record(t_gnl_trace *t, int phase, uint64_t ns);
+uint64_t	gnl_trace_now(void);
+int			gnl_trace_next_view(t_gnl_reader *r, t_gnl_trace *t,
+				t_gnl_view *line);
+char		*gnl_trace_next(t_gnl_reader *r, t_gnl_trace *t);
+int			gnl_trace_export(const t_gnl_trace *t, int fd);
+
+# endif
+
+#endif //GNL_TRACE_H
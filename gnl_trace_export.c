@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_trace_export.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 11:21:45 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/20 11:35:03 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <string.h>
+#include "gnl_trace.h"
+
+#ifdef GNL_TRACE
+
+static uint64_t	hist_value(size_t idx)
+{
+	int	e;
+
+	if (idx < GNL_HIST_SUB)
+		return (idx);
+	e = (int)(idx >> GNL_HIST_SUB_BITS) + GNL_HIST_SUB_BITS - 1;
+	return ((uint64_t)(GNL_HIST_SUB + (idx & (GNL_HIST_SUB - 1)))
+		<< (e - GNL_HIST_SUB_BITS));
+}
+
+static uint64_t	hist_percentile(const t_gnl_hist *h, double pct)
+{
+	uint64_t	rank;
+	uint64_t	seen;
+	size_t		idx;
+
+	if (h->count == 0)
+		return (0);
+	rank = (uint64_t)(pct / 100.0 * (double)h->count + 0.5);
+	if (rank == 0)
+		rank = 1;
+	seen = 0;
+	idx = 0;
+	while (idx < GNL_HIST_BUCKETS)
+	{
+		seen += h->counts[idx];
+		if (seen >= rank)
+			break ;
+		idx++;
+	}
+	if (hist_value(idx) < h->min)
+		return (h->min);
+	return (hist_value(idx));
+}
+
+static int	export_phase(const t_gnl_hist *h, const char *name, int fd)
+{
+	char	text[256];
+	int		len;
+
+	len = snprintf(text, sizeof(text), "%-5s %10llu %10llu %10llu %10llu"
+			" %10llu %10llu %10llu %10llu\n", name,
+			(unsigned long long)h->count, (unsigned long long)h->min,
+			(unsigned long long)hist_percentile(h, 50.0),
+			(unsigned long long)hist_percentile(h, 90.0),
+			(unsigned long long)hist_percentile(h, 99.0),
+			(unsigned long long)hist_percentile(h, 99.9),
+			(unsigned long long)h->max,
+			(unsigned long long)(h->sum / (h->count + (h->count == 0))));
+	if (len < 0)
+		return (GNL_ERROR);
+	return (gnl_write_all(fd, text, (size_t)len));
+}
+
+int	gnl_trace_export(const t_gnl_trace *t, int fd)
+{
+	static const char	*names[GNL_TRACE_PHASES] = {"wait", "scan", "copy"};
+	const char			*head;
+	int					phase;
+
+	head = "phase      count     min_ns     p50_ns     p90_ns     p99_ns"
+		"    p999_ns     max_ns    mean_ns\n";
+	if (gnl_write_all(fd, head, strlen(head)) < 0)
+		return (GNL_ERROR);
+	phase = 0;
+	while (phase < GNL_TRACE_PHASES)
+	{
+		if (export_phase(&t->hist[phase], names[phase], fd) < 0)
+			return (GNL_ERROR);
+		phase++;
+	}
+	return (0);
+}
+
+#endif
@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_trace_reader.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 11:14:09 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/20 11:36:22 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <time.h>
+#include "gnl_trace.h"
+
+#ifdef GNL_TRACE
+
+uint64_t	gnl_trace_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+
+int	gnl_trace_next_view(t_gnl_reader *r, t_gnl_trace *t, t_gnl_view *line)
+{
+	uint64_t	since;
+	uint64_t	waited;
+	uint64_t	ns;
+	int			ret;
+
+	waited = t->waited;
+	since = gnl_trace_now();
+	ret = gnl_reader_next_view(r, line);
+	ns = gnl_trace_now() - since;
+	waited = t->waited - waited;
+	if (ns > waited)
+		ns -= waited;
+	else
+		ns = 0;
+	gnl_trace_record(t, GNL_TRACE_SCAN, ns);
+	return (ret);
+}
+
+char	*gnl_trace_next(t_gnl_reader *r, t_gnl_trace *t)
+{
+	t_gnl_view	view;
+	uint64_t	since;
+	char		*line;
+
+	if (gnl_trace_next_view(r, t, &view) != GNL_LINE)
+		return (NULL);
+	since = gnl_trace_now();
+	line = gnl_reader_copy(r, &view);
+	gnl_trace_record(t, GNL_TRACE_COPY, gnl_trace_now() - since);
+	return (line);
+}
+
+#endif
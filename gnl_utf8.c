@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_utf8.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:27:12 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/19 14:27:12 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <stdint.h>
+#include <string.h>
+#include "gnl_utf8.h"
+
+static void	utf8_lead(t_gnl_utf8 *u, unsigned char c)
+{
+	u->lo = 0x80;
+	u->hi = 0xBF;
+	u->need = 0;
+	if (c >= 0xC2 && c <= 0xDF)
+		u->need = 1;
+	else if (c >= 0xE0 && c <= 0xEF)
+		u->need = 2;
+	else if (c >= 0xF0 && c <= 0xF4)
+		u->need = 3;
+	if (c == 0xE0)
+		u->lo = 0xA0;
+	else if (c == 0xED)
+		u->hi = 0x9F;
+	else if (c == 0xF0)
+		u->lo = 0x90;
+	else if (c == 0xF4)
+		u->hi = 0x8F;
+	u->ascii = 0;
+	if (u->need == 0)
+	{
+		u->valid = 0;
+		u->codepoints++;
+	}
+}
+
+static void	utf8_byte(t_gnl_utf8 *u, unsigned char c)
+{
+	if (u->need == 0 && c < 0x80)
+		u->codepoints++;
+	else if (u->need == 0)
+		utf8_lead(u, c);
+	else if (c >= u->lo && c <= u->hi)
+	{
+		u->lo = 0x80;
+		u->hi = 0xBF;
+		if (--u->need == 0)
+			u->codepoints++;
+	}
+	else
+	{
+		u->valid = 0;
+		u->need = 0;
+		u->codepoints++;
+		utf8_byte(u, c);
+	}
+}
+
+size_t	gnl_scan_utf8(const char *s, size_t len, t_gnl_utf8 *u)
+{
+	size_t		i;
+	uint64_t	word;
+	uint64_t	x;
+
+	i = 0;
+	while (i < len && s[i] != '\n')
+	{
+		if (u->need == 0 && i + 8 <= len)
+		{
+			memcpy(&word, s + i, 8);
+			x = word ^ (GNL_ONES * '\n');
+			if (!(word & GNL_HIGHS) && !((x - GNL_ONES) & ~x & GNL_HIGHS))
+			{
+				u->codepoints += 8;
+				i += 8;
+				continue ;
+			}
+		}
+		utf8_byte(u, (unsigned char)s[i++]);
+	}
+	return (i);
+}
+
+static int	utf8_emit(t_gnl_reader *r, t_gnl_view *line, t_gnl_utf8 *u,
+		size_t stop)
+{
+	if (u->need)
+	{
+		u->valid = 0;
+		u->need = 0;
+		u->codepoints++;
+	}
+	if (stop < r->end)
+	{
+		u->codepoints++;
+		stop++;
+	}
+	return (gnl_reader_emit(r, line, stop));
+}
+
+int	gnl_reader_next_utf8(t_gnl_reader *r, t_gnl_view *line, t_gnl_utf8 *info)
+{
+	int	ret;
+
+	info->codepoints = 0;
+	info->valid = 1;
+	info->ascii = 1;
+	info->need = 0;
+	r->scan = r->start;
+	r->scan += gnl_scan_utf8(r->buf + r->scan, r->end - r->scan, info);
+	while (r->scan == r->end)
+	{
+		ret = gnl_reader_fill(r);
+		if (ret < 0)
+			return (ret);
+		if (ret == 0 && r->start == r->end)
+			return (GNL_EOF);
+		if (ret == 0)
+			return (utf8_emit(r, line, info, r->end));
+		r->scan += gnl_scan_utf8(r->buf + r->scan, r->end - r->scan, info);
+	}
+	return (utf8_emit(r, line, info, r->scan));
+}
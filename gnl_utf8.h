@@ -0,0 +1,32 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_utf8.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:20:55 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/19 14:20:55 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_UTF8_H
+# define GNL_UTF8_H
+
+# include "gnl_reader.h"
+
+typedef struct s_gnl_utf8
+{
+	size_t			codepoints;
+	int				valid;
+	int				ascii;
+	int				need;
+	unsigned char	lo;
+	unsigned char	hi;
+}	t_gnl_utf8;
+
+int		gnl_reader_next_utf8(t_gnl_reader *r, t_gnl_view *line,
+			t_gnl_utf8 *info);
+size_t	gnl_scan_utf8(const char *s, size_t len, t_gnl_utf8 *u);
+
+#endif //GNL_UTF8_H
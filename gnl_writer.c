@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_writer.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 11:09:18 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 13:02:44 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "gnl_writer.h"
+
+int	gnl_writer_init(t_gnl_writer *w, int fd, const t_gnl_writer_cfg *cfg)
+{
+	w->fd = fd;
+	w->cfg = *cfg;
+	if (w->cfg.max_iov == 0 || w->cfg.max_iov > IOV_MAX)
+		w->cfg.max_iov = IOV_MAX;
+	if (w->cfg.max_bytes == 0)
+		w->cfg.max_bytes = SIZE_MAX;
+	w->count = 0;
+	w->bytes = 0;
+	w->src_fd = -1;
+	w->iov = (struct iovec *)malloc(sizeof(struct iovec) * w->cfg.max_iov);
+	if (!w->iov)
+		return (GNL_ERROR);
+	return (0);
+}
+
+long	gnl_writer_remaining_us(const t_gnl_writer *w)
+{
+	struct timespec	now;
+	long			elapsed_us;
+
+	if (w->cfg.max_latency_us <= 0)
+		return (0);
+	if (w->count == 0)
+		return (w->cfg.max_latency_us);
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	elapsed_us = (now.tv_sec - w->oldest.tv_sec) * 1000000L
+		+ (now.tv_nsec - w->oldest.tv_nsec) / 1000;
+	return (w->cfg.max_latency_us - elapsed_us);
+}
+
+int	gnl_writer_add(t_gnl_writer *w, const t_gnl_view *line)
+{
+	struct iovec	*last;
+
+	last = NULL;
+	if (w->count > 0)
+		last = &w->iov[w->count - 1];
+	if (last && (char *)last->iov_base + last->iov_len == line->data)
+		last->iov_len += line->len;
+	else
+	{
+		if (w->count == w->cfg.max_iov && gnl_writer_flush(w) < 0)
+			return (GNL_ERROR);
+		if (w->count == 0 && w->cfg.max_latency_us > 0)
+			clock_gettime(CLOCK_MONOTONIC, &w->oldest);
+		w->iov[w->count].iov_base = (void *)line->data;
+		w->iov[w->count++].iov_len = line->len;
+	}
+	w->bytes += line->len;
+	if (w->bytes >= w->cfg.max_bytes
+		|| (w->cfg.max_latency_us > 0 && gnl_writer_remaining_us(w) <= 0))
+		return (gnl_writer_flush(w));
+	return (0);
+}
@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_writer.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 11:02:36 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 13:02:44 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GNL_WRITER_H
+# define GNL_WRITER_H
+
+# include <limits.h>
+# include <stdint.h>
+# include <sys/uio.h>
+# include <time.h>
+# include "gnl_reader.h"
+
+# ifndef IOV_MAX
+#  define IOV_MAX 1024
+# endif
+
+typedef struct s_gnl_writer_cfg
+{
+	size_t	max_iov;
+	size_t	max_bytes;
+	long	max_latency_us;
+}	t_gnl_writer_cfg;
+
+typedef struct s_gnl_writer
+{
+	int					fd;
+	struct iovec		*iov;
+	size_t				count;
+	size_t				bytes;
+	t_gnl_writer_cfg	cfg;
+	struct timespec		oldest;
+	int					src_fd;
+}	t_gnl_writer;
+
+int		gnl_writer_init(t_gnl_writer *w, int fd, const t_gnl_writer_cfg *cfg);
+void	gnl_writer_attach(t_gnl_writer *w, t_gnl_reader *r, int src_fd);
+int		gnl_writer_add(t_gnl_writer *w, const t_gnl_view *line);
+int		gnl_writer_flush(t_gnl_writer *w);
+int		gnl_writer_destroy(t_gnl_writer *w);
+long	gnl_writer_remaining_us(const t_gnl_writer *w);
+
+#endif //GNL_WRITER_H
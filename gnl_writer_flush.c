@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_writer_flush.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 11:17:55 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/20 11:17:55 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include "gnl_writer.h"
+
+static void	writer_advance(t_gnl_writer *w, size_t *first, size_t written)
+{
+	while (*first < w->count && written >= w->iov[*first].iov_len)
+	{
+		written -= w->iov[*first].iov_len;
+		w->bytes -= w->iov[*first].iov_len;
+		(*first)++;
+	}
+	if (*first < w->count)
+	{
+		w->iov[*first].iov_base = (char *)w->iov[*first].iov_base + written;
+		w->iov[*first].iov_len -= written;
+		w->bytes -= written;
+	}
+}
+
+int	gnl_writer_flush(t_gnl_writer *w)
+{
+	size_t	first;
+	ssize_t	written;
+
+	first = 0;
+	while (first < w->count)
+	{
+		written = writev(w->fd, w->iov + first, w->count - first);
+		if (written < 0 && errno == EINTR)
+			continue ;
+		if (written < 0)
+		{
+			memmove(w->iov, w->iov + first,
+				sizeof(struct iovec) * (w->count - first));
+			w->count -= first;
+			return (GNL_ERROR);
+		}
+		writer_advance(w, &first, (size_t)written);
+	}
+	w->count = 0;
+	w->bytes = 0;
+	return (0);
+}
+
+int	gnl_writer_destroy(t_gnl_writer *w)
+{
+	int	ret;
+
+	ret = gnl_writer_flush(w);
+	free(w->iov);
+	w->iov = NULL;
+	return (ret);
+}
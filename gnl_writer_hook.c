@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_writer_hook.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nyoong <nyoong@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/21 13:05:19 by nyoong            #+#    #+#             */
+/*   Updated: 2026/10/21 13:05:19 by nyoong           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <poll.h>
+#include "gnl_writer.h"
+
+static int	writer_idle(t_gnl_writer *w, long remaining_us)
+{
+	struct pollfd	pfd;
+	int				ret;
+
+	if (w->src_fd < 0)
+		return (1);
+	pfd.fd = w->src_fd;
+	pfd.events = POLLIN;
+	ret = poll(&pfd, 1, (int)((remaining_us + 999) / 1000));
+	return (ret <= 0);
+}
+
+static int	writer_on_fill(void *ctx, int recycle)
+{
+	t_gnl_writer	*w;
+	long			remaining_us;
+
+	w = (t_gnl_writer *)ctx;
+	if (w->count == 0)
+		return (0);
+	remaining_us = gnl_writer_remaining_us(w);
+	if (recycle || remaining_us <= 0 || writer_idle(w, remaining_us))
+		return (gnl_writer_flush(w));
+	return (0);
+}
+
+void	gnl_writer_attach(t_gnl_writer *w, t_gnl_reader *r, int src_fd)
+{
+	w->src_fd = src_fd;
+	r->on_fill = writer_on_fill;
+	r->hook_ctx = w;
+}
@@ -209,6 +209,47 @@ void test_multiple_fds_with_eof()
     close(fd2);
 }
 
+// Test reading many file descriptors in lockstep so per-fd nodes span several slabs
+void test_many_fds()
+{
+    enum { FD_COUNT = 150, LINE_COUNT = 3 };
+    int fds[FD_COUNT];
+    char name[64];
+    char expected[128];
+
+    for (int i = 0; i < FD_COUNT; i++)
+    {
+        snprintf(name, sizeof(name), "test_many_%d.txt", i);
+        // Alternate between short lines that stay inline and long ones that do not
+        snprintf(expected, sizeof(expected), "fd %d a\nfd %d %s\nfd %d c\n", i, i,
+            i % 2 ? "a considerably longer line that will not fit inline" : "b", i);
+        create_test_file(name, expected);
+        fds[i] = open(name, O_RDONLY);
+        assert(fds[i] != -1);
+    }
+
+    for (int l = 0; l < LINE_COUNT; l++)
+    {
+        for (int i = 0; i < FD_COUNT; i++)
+        {
+            char *line = get_next_line(fds[i]);
+            if (l == 1)
+                snprintf(expected, sizeof(expected), "fd %d %s\n", i,
+                    i % 2 ? "a considerably longer line that will not fit inline" : "b");
+            else
+                snprintf(expected, sizeof(expected), "fd %d %c\n", i, l ? 'c' : 'a');
+            assert(line && strcmp(line, expected) == 0);
+            free(line);
+        }
+    }
+
+    for (int i = 0; i < FD_COUNT; i++)
+    {
+        assert(get_next_line(fds[i]) == NULL);
+        close(fds[i]);
+    }
+}
+
 // Main function to run the tests
 int main()
 {
@@ -218,6 +259,7 @@ int main()
     test_multiple_files_no_newline();
     test_file_with_empty_line();
     test_multiple_fds_with_eof();
+    test_many_fds();
 
     printf("All tests passed successfully!\n");
 
@@ -0,0 +1,120 @@
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include "gnl_async.hpp"
+
+// Reads every line of one connection without blocking the loop
+gnl::task collect(gnl::event_loop &loop, int fd, std::vector<std::string> &out) {
+    gnl::async_line_stream lines(loop, fd);
+    while (auto line = co_await lines.next())
+        out.emplace_back(*line);
+}
+
+// Gives up with an exception on the first line that is not a number
+gnl::task sum_numbers(gnl::event_loop &loop, int fd, long &sum) {
+    gnl::async_line_stream lines(loop, fd);
+    while (auto line = co_await lines.next()) {
+        if (line->empty() || (*line)[0] < '0' || (*line)[0] > '9')
+            throw std::invalid_argument(std::string(*line));
+        sum += std::stol(std::string(*line));
+    }
+}
+
+gnl::task total(gnl::event_loop &loop, int fd, long &sum, bool &caught) {
+    try {
+        co_await sum_numbers(loop, fd, sum);
+    } catch (const std::invalid_argument &) {
+        caught = true;
+    }
+}
+
+void test_async_pipes() {
+    const int count = 8;
+    int fds[count][2];
+    std::vector<std::string> got[count];
+
+    gnl::event_loop loop;
+    std::vector<gnl::task> tasks;
+    for (int i = 0; i < count; i++) {
+        assert(pipe(fds[i]) == 0);
+        tasks.push_back(collect(loop, fds[i][0], got[i]));
+    }
+
+    // Lines arrive in pieces, interleaved across all pipes
+    std::thread writer([&] {
+        for (int round = 0; round < 3; round++) {
+            for (int i = 0; i < count; i++) {
+                std::string chunk = "pipe " + std::to_string(i) + " line "
+                    + std::to_string(round);
+                assert(write(fds[i][1], chunk.data(), 6) == 6);
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                assert(write(fds[i][1], chunk.data() + 6, chunk.size() - 6)
+                    == (ssize_t)(chunk.size() - 6));
+                assert(write(fds[i][1], "\n", 1) == 1);
+            }
+        }
+        for (int i = 0; i < count; i++)
+            close(fds[i][1]);
+    });
+    loop.run();
+    writer.join();
+
+    for (int i = 0; i < count; i++) {
+        assert(tasks[i].done());
+        tasks[i].get();
+        // The stream handed the fd back in blocking mode
+        assert(!(fcntl(fds[i][0], F_GETFL) & O_NONBLOCK));
+        assert(got[i].size() == 3);
+        for (int round = 0; round < 3; round++)
+            assert(got[i][round] == "pipe " + std::to_string(i) + " line "
+                + std::to_string(round) + "\n");
+        close(fds[i][0]);
+    }
+}
+
+void test_async_exceptions() {
+    int fds[2];
+    assert(pipe(fds) == 0);
+    gnl::event_loop loop;
+    long sum = 0;
+    bool caught = false;
+    gnl::task outer = total(loop, fds[0], sum, caught);
+
+    // The body throws after a suspension; the awaiting coroutine catches it
+    std::thread writer([&] {
+        assert(write(fds[1], "4\n", 2) == 2);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        assert(write(fds[1], "5\nbad\n", 6) == 6);
+    });
+    loop.run();
+    writer.join();
+    assert(outer.done() && caught && sum == 9);
+    outer.get();
+
+    // Without an awaiter the exception waits in the task for get()
+    assert(write(fds[1], "x\n", 2) == 2);
+    gnl::task lone = sum_numbers(loop, fds[0], sum);
+    assert(lone.done());
+    bool rethrown = false;
+    try {
+        lone.get();
+    } catch (const std::invalid_argument &e) {
+        rethrown = std::string(e.what()) == "x\n";
+    }
+    assert(rethrown);
+    close(fds[0]);
+    close(fds[1]);
+}
+
+int main() {
+    test_async_pipes();
+    test_async_exceptions();
+    printf("All tests passed.\n");
+    return 0;
+}
@@ -0,0 +1,467 @@
+#ifndef _GNU_SOURCE
+# define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <sys/wait.h>
+#include "gnl_reader.h"
+#include "gnl_record.h"
+#include "gnl_reverse.h"
+#include "gnl_filter.h"
+#include "gnl_utf8.h"
+#include "gnl_batch.h"
+#ifdef GNL_MANDATORY
+# include "get_next_line.h"
+#else
+# include "get_next_line_bonus.h"
+#endif
+
+// Differential tester: every reader must produce exactly the lines of a
+// trivially-correct splitter, whatever the content and however it is chunked.
+// Run with a seed as argv[1] to reproduce a failure. Build it once with the
+// bonus get_next_line and once with -DGNL_MANDATORY and the mandatory one.
+
+static unsigned long long rng_state;
+
+unsigned long long rng() {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+size_t rng_below(size_t n) {
+    return n ? rng() % n : 0;
+}
+
+typedef struct {
+    size_t count;
+    size_t *start;
+    size_t *len;
+} line_set;
+
+// Reference splitter: lines keep their '\n', a non-empty tail is a line
+void reference_lines(const char *data, size_t size, line_set *out) {
+    out->count = 0;
+    out->start = malloc(sizeof(size_t) * (size + 1));
+    out->len = malloc(sizeof(size_t) * (size + 1));
+    size_t begin = 0;
+    for (size_t i = 0; i < size; i++) {
+        if (data[i] == '\n') {
+            out->start[out->count] = begin;
+            out->len[out->count++] = i + 1 - begin;
+            begin = i + 1;
+        }
+    }
+    if (begin < size) {
+        out->start[out->count] = begin;
+        out->len[out->count++] = size - begin;
+    }
+}
+
+void free_lines(line_set *lines) {
+    free(lines->start);
+    free(lines->len);
+}
+
+void expect_line(const char *data, const line_set *ref, size_t n, const char *got, size_t len) {
+    assert(n < ref->count);
+    assert(len == ref->len[n]);
+    assert(memcmp(got, data + ref->start[n], len) == 0);
+}
+
+// Content generator biased towards the edge cases: empty lines, runs of
+// newlines, lines around BUFFER_SIZE and block boundaries, UTF-8, CSV
+// punctuation and (optionally) NUL bytes.
+char *random_content(size_t *size, int allow_nul) {
+    size_t cap = rng_below(4) ? rng_below(4096) : rng_below(3 * GNL_BLOCK_SIZE);
+    char *data = malloc(cap + 1);
+    size_t i = 0;
+    while (i < cap) {
+        size_t kind = rng_below(10);
+        if (kind == 0)
+            data[i++] = '\n';
+        else if (kind == 1) {
+            // Valid sequences of every length, then overlong, surrogate,
+            // out-of-range and truncated ones
+            static const char *seqs[] = {"\xe2\x82\xac", "\xc3\xa9", "\xf0\x9f\x98\x80",
+                "\xc0\xaf", "\xed\xa0\x80", "\xf4\x90\x80\x80", "\xe0\x80"};
+            const char *seq = seqs[rng_below(7)];
+            if (i + strlen(seq) <= cap) {
+                memcpy(data + i, seq, strlen(seq));
+                i += strlen(seq);
+            }
+        } else if (kind == 2)
+            data[i++] = (char)(rng_below(255) + 1);
+        else if (kind == 3 && allow_nul)
+            data[i++] = '\0';
+        else if (kind == 4)
+            data[i++] = ",\"\t\r"[rng_below(4)];
+        else
+            data[i++] = 'a' + rng_below(26);
+        if (rng_below(40) == 0) {
+            size_t run = rng_below(200);
+            while (run-- > 0 && i < cap)
+                data[i++] = 'x';
+        }
+    }
+    if (!allow_nul)
+        for (size_t j = 0; j < i; j++)
+            if (data[j] == '\0')
+                data[j] = 'z';
+    data[i] = '\0';
+    *size = i;
+    return data;
+}
+
+typedef struct {
+    const char *data;
+    size_t size;
+    size_t pos;
+} chunk_ctx;
+
+ssize_t chunk_read(void *ctx, char *dst, size_t size) {
+    chunk_ctx *c = ctx;
+    size_t n = 1 + rng_below(rng_below(8) ? 64 : 70000);
+    if (n > size)
+        n = size;
+    if (n > c->size - c->pos)
+        n = c->size - c->pos;
+    memcpy(dst, c->data + c->pos, n);
+    c->pos += n;
+    return (ssize_t)n;
+}
+
+void check_reader(t_gnl_reader *reader, const char *data, const line_set *ref) {
+    t_gnl_view view;
+    size_t n = 0;
+    while (gnl_reader_next_view(reader, &view) == GNL_LINE)
+        expect_line(data, ref, n++, view.data, view.len);
+    assert(n == ref->count);
+    gnl_reader_destroy(reader);
+}
+
+void check_memory_and_chunks(const char *data, size_t size, const line_set *ref) {
+    t_gnl_reader reader;
+    gnl_reader_init_mem(&reader, data, size);
+    check_reader(&reader, data, ref);
+
+    chunk_ctx ctx = {data, size, 0};
+    assert(gnl_reader_init(&reader, gnl_source_callback(chunk_read, &ctx)) == 0);
+    check_reader(&reader, data, ref);
+}
+
+// Child process that feeds a pipe with writes of arbitrary sizes
+int spawn_writer(const char *data, size_t size) {
+    int fds[2];
+    assert(pipe(fds) == 0);
+    unsigned long long seed = rng();
+    if (fork() == 0) {
+        close(fds[0]);
+        rng_state = seed;
+        size_t pos = 0;
+        while (pos < size) {
+            size_t n = 1 + rng_below(rng_below(4) ? 16 : 9000);
+            if (n > size - pos)
+                n = size - pos;
+            ssize_t w = write(fds[1], data + pos, n);
+            if (w <= 0)
+                _exit(1);
+            pos += w;
+        }
+        _exit(0);
+    }
+    close(fds[1]);
+    return fds[0];
+}
+
+// A single pipe drained by get_next_line: the only pattern the mandatory
+// part supports, since it keeps state for one fd at a time
+void check_gnl_pipe(const char *data, size_t size, const line_set *ref) {
+    int fd = spawn_writer(data, size);
+    size_t n = 0;
+    char *line;
+    while ((line = get_next_line(fd)) != NULL) {
+        expect_line(data, ref, n++, line, strlen(line));
+        free(line);
+    }
+    assert(n == ref->count);
+    close(fd);
+    while (wait(NULL) > 0)
+        ;
+}
+
+#ifndef GNL_MANDATORY
+// Two pipes read alternately: one through the reader, one through the
+// bonus get_next_line, both interleaved with a third plain-gnl pipe.
+void check_interleaved_pipes(const char *data, size_t size, const line_set *ref) {
+    int fd_reader = spawn_writer(data, size);
+    int fd_gnl_a = spawn_writer(data, size);
+    int fd_gnl_b = spawn_writer(data, size);
+
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_fd(fd_reader)) == 0);
+    size_t n_reader = 0, n_a = 0, n_b = 0;
+    int live = 3;
+    while (live > 0) {
+        live = 0;
+        t_gnl_view view;
+        if (gnl_reader_next_view(&reader, &view) == GNL_LINE) {
+            expect_line(data, ref, n_reader++, view.data, view.len);
+            live++;
+        }
+        for (int k = 0; k < 2; k++) {
+            char *line = get_next_line(k ? fd_gnl_b : fd_gnl_a);
+            if (line) {
+                size_t *n = k ? &n_b : &n_a;
+                expect_line(data, ref, (*n)++, line, strlen(line));
+                free(line);
+                live++;
+            }
+        }
+    }
+    assert(n_reader == ref->count && n_a == ref->count && n_b == ref->count);
+    gnl_reader_destroy(&reader);
+    close(fd_reader);
+    close(fd_gnl_a);
+    close(fd_gnl_b);
+    while (wait(NULL) > 0)
+        ;
+}
+#endif
+
+void check_reverse(const char *data, size_t size, const line_set *ref) {
+    FILE *file = fopen("test_differential.txt", "w");
+    fwrite(data, 1, size, file);
+    fclose(file);
+
+    int fd = open("test_differential.txt", O_RDONLY);
+    assert(fd != -1);
+    t_gnl_rreader reader;
+    assert(gnl_rreader_init(&reader, fd) == 0);
+    t_gnl_view view;
+    size_t n = ref->count;
+    while (gnl_rreader_next_view(&reader, &view) == GNL_LINE) {
+        assert(n > 0);
+        expect_line(data, ref, --n, view.data, view.len);
+    }
+    assert(n == 0);
+    gnl_rreader_destroy(&reader);
+    close(fd);
+    unlink("test_differential.txt");
+}
+
+void check_filter(const char *data, size_t size, const line_set *ref) {
+    // Pick a needle from the content itself so that it actually matches
+    char needle[8] = "zz";
+    if (size > 8) {
+        size_t at = rng_below(size - 8);
+        size_t len = 1 + rng_below(4);
+        memcpy(needle, data + at, len);
+        needle[len] = '\0';
+        if (strchr(needle, '\n') || strlen(needle) != len)
+            strcpy(needle, "zz");
+    }
+    const char *patterns[] = {needle, "\xe2\x82\xac\xe2\x82\xac"};
+    t_gnl_filter filter;
+    assert(gnl_filter_init(&filter, patterns, 2) == 0);
+
+    chunk_ctx ctx = {data, size, 0};
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_callback(chunk_read, &ctx)) == 0);
+    t_gnl_view view;
+    size_t n = 0;
+    while (gnl_reader_next_match(&reader, &filter, &view) == GNL_LINE) {
+        while (n < ref->count
+            && !memmem(data + ref->start[n], ref->len[n], patterns[0], strlen(patterns[0]))
+            && !memmem(data + ref->start[n], ref->len[n], patterns[1], strlen(patterns[1])))
+            n++;
+        expect_line(data, ref, n++, view.data, view.len);
+    }
+    while (n < ref->count) {
+        assert(!memmem(data + ref->start[n], ref->len[n], patterns[0], strlen(patterns[0])));
+        assert(!memmem(data + ref->start[n], ref->len[n], patterns[1], strlen(patterns[1])));
+        n++;
+    }
+    assert(reader.lines == ref->count);
+    gnl_filter_destroy(&filter);
+    gnl_reader_destroy(&reader);
+}
+
+// Reference UTF-8 check: decode every sequence to its scalar value, then
+// reject overlong forms, surrogates and anything above U+10FFFF
+int reference_utf8_valid(const unsigned char *s, size_t len) {
+    static const unsigned long min_cp[] = {0, 0, 0x80, 0x800, 0x10000};
+    size_t i = 0;
+    while (i < len) {
+        size_t n = 0;
+        if (s[i] < 0x80)
+            n = 1;
+        else if ((s[i] & 0xE0) == 0xC0)
+            n = 2;
+        else if ((s[i] & 0xF0) == 0xE0)
+            n = 3;
+        else if ((s[i] & 0xF8) == 0xF0)
+            n = 4;
+        if (n == 0 || i + n > len)
+            return 0;
+        unsigned long cp = n == 1 ? s[i] : s[i] & (0x7F >> n);
+        for (size_t k = 1; k < n; k++) {
+            if ((s[i + k] & 0xC0) != 0x80)
+                return 0;
+            cp = cp << 6 | (s[i + k] & 0x3F);
+        }
+        if (cp < min_cp[n] || (cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF)
+            return 0;
+        i += n;
+    }
+    return 1;
+}
+
+void check_utf8(const char *data, size_t size, const line_set *ref) {
+    chunk_ctx ctx = {data, size, 0};
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_callback(chunk_read, &ctx)) == 0);
+    t_gnl_view view;
+    t_gnl_utf8 info;
+    size_t n = 0;
+    while (gnl_reader_next_utf8(&reader, &view, &info) == GNL_LINE) {
+        expect_line(data, ref, n++, view.data, view.len);
+        int ascii = 1;
+        size_t leads = 0;
+        for (size_t i = 0; i < view.len; i++) {
+            ascii &= !(view.data[i] & 0x80);
+            leads += ((unsigned char)view.data[i] & 0xC0) != 0x80;
+        }
+        assert(info.ascii == ascii);
+        assert(info.valid == reference_utf8_valid((const unsigned char *)view.data, view.len));
+        if (info.valid)
+            assert(info.codepoints == leads);
+    }
+    assert(n == ref->count);
+    gnl_reader_destroy(&reader);
+}
+
+void reference_field(const char *data, size_t begin, size_t end, int quotes, line_set *fields) {
+    int quoted = quotes && end - begin >= 2 && data[begin] == '"' && data[end - 1] == '"';
+    fields->start[fields->count] = begin + quoted;
+    fields->len[fields->count++] = end - begin - 2 * quoted;
+}
+
+// Reference CSV splitter, one byte at a time: a quote opens a quoted
+// section only as the first byte of a field, and "" inside one is a quote.
+// Returns the length of the record at data and fills in its fields.
+size_t reference_record(const char *data, size_t size, char delim, int quotes, line_set *fields) {
+    size_t begin = 0;
+    int state = 0;
+
+    fields->count = 0;
+    for (size_t i = 0; i < size; i++) {
+        // 0: unquoted, 1: inside quotes, 2: just after a closing quote
+        if (state == 1) {
+            if (data[i] == '"')
+                state = 2;
+            continue;
+        }
+        if ((state == 2 || (quotes && i == begin)) && data[i] == '"') {
+            state = 1;
+            continue;
+        }
+        state = 0;
+        if (data[i] != delim && data[i] != '\n')
+            continue;
+        size_t end = i;
+        if (data[i] == '\n' && end > begin && data[end - 1] == '\r')
+            end--;
+        reference_field(data, begin, end, quotes, fields);
+        begin = i + 1;
+        if (data[i] == '\n')
+            return i + 1;
+    }
+    size_t end = size;
+    if (end > begin && data[end - 1] == '\r')
+        end--;
+    reference_field(data, begin, end, quotes, fields);
+    return size;
+}
+
+void check_records(const char *data, size_t size) {
+    chunk_ctx ctx = {data, size, 0};
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_callback(chunk_read, &ctx)) == 0);
+    char delim = rng_below(2) ? ',' : '\t';
+    int quotes = rng_below(4) != 0;
+    t_gnl_record rec;
+    assert(gnl_record_init(&rec, delim, quotes) == 0);
+    line_set fields = {0, malloc(sizeof(size_t) * (size + 1)), malloc(sizeof(size_t) * (size + 1))};
+    size_t consumed = 0;
+    while (gnl_reader_next_record(&reader, &rec) == GNL_LINE) {
+        size_t len = reference_record(data + consumed, size - consumed, delim, quotes, &fields);
+        assert(rec.line.len == len && memcmp(rec.line.data, data + consumed, len) == 0);
+        assert(rec.nfields == fields.count);
+        for (size_t i = 0; i < rec.nfields; i++)
+            assert(rec.fields[i].start == fields.start[i] && rec.fields[i].len == fields.len[i]);
+        consumed += len;
+    }
+    assert(consumed == size);
+    free_lines(&fields);
+    gnl_record_destroy(&rec);
+    gnl_reader_destroy(&reader);
+}
+
+void check_batch(const char *data, size_t size, const line_set *ref) {
+    chunk_ctx ctx = {data, size, 0};
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_callback(chunk_read, &ctx)) == 0);
+    t_gnl_batch batch;
+    size_t target = 1 + rng_below(rng_below(2) ? 256 : 3 * GNL_BLOCK_SIZE);
+    assert(gnl_batch_init(&batch, target) == 0);
+    size_t n = 0;
+    while (gnl_reader_next_batch(&reader, &batch) == GNL_LINE) {
+        assert(batch.count > 0);
+        assert(batch.count == 1 || batch.size <= target);
+        for (size_t i = 0; i < batch.count; i++)
+            expect_line(data, ref, n++, batch.data + batch.offsets[i],
+                batch.offsets[i + 1] - batch.offsets[i]);
+    }
+    assert(n == ref->count);
+    gnl_batch_destroy(&batch);
+    gnl_reader_destroy(&reader);
+}
+
+int main(int argc, char **argv) {
+    unsigned long long seed = argc > 1 ? strtoull(argv[1], NULL, 10) : 42;
+    int rounds = argc > 2 ? atoi(argv[2]) : 100;
+
+    for (int round = 0; round < rounds; round++) {
+        rng_state = seed * 2654435761ULL + round + 1;
+        int text_only = round % 2;
+        size_t size;
+        char *data = random_content(&size, !text_only);
+        line_set ref;
+        reference_lines(data, size, &ref);
+
+        check_memory_and_chunks(data, size, &ref);
+        check_reverse(data, size, &ref);
+        check_filter(data, size, &ref);
+        check_utf8(data, size, &ref);
+        check_batch(data, size, &ref);
+        check_records(data, size);
+        if (text_only)
+            check_gnl_pipe(data, size, &ref);
+#ifndef GNL_MANDATORY
+        if (text_only)
+            check_interleaved_pipes(data, size, &ref);
+#endif
+
+        free_lines(&ref);
+        free(data);
+    }
+
+    printf("All tests passed.\n");
+    return 0;
+}
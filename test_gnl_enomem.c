@@ -0,0 +1,155 @@
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include "gnl_reader.h"
+#include "gnl_intern.h"
+#include "get_next_line.h"
+
+// Allocation-failure tests. Build with -Wl,--wrap=malloc so that every
+// malloc goes through the hook below, together with the gnl_*.c sources
+// and the mandatory get_next_line.c and get_next_line_utils.c.
+
+void *__real_malloc(size_t size);
+
+static int failing = 0;
+static size_t mallocs = 0;
+
+void *__wrap_malloc(size_t size) {
+    mallocs++;
+    if (failing) {
+        errno = ENOMEM;
+        return NULL;
+    }
+    return __real_malloc(size);
+}
+
+static size_t long_len = GNL_BLOCK_SIZE * 3;
+
+void create_long_file(const char *filename) {
+    FILE *file = fopen(filename, "w");
+    fputs("short\n", file);
+    for (size_t i = 0; i < long_len; i++)
+        fputc('r', file);
+    fputs("\ntail\n", file);
+    fclose(file);
+}
+
+void test_reader_grow_failure() {
+    create_long_file("test_enomem.txt");
+    int fd = open("test_enomem.txt", O_RDONLY);
+    assert(fd != -1);
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_fd(fd)) == 0);
+
+    // The buffer cannot grow for the long line; nothing is lost meanwhile
+    t_gnl_view view;
+    failing = 1;
+    assert(gnl_reader_next_view(&reader, &view) == GNL_LINE && view.len == 6);
+    assert(gnl_reader_next_view(&reader, &view) == GNL_ENOMEM);
+    assert(gnl_reader_next_view(&reader, &view) == GNL_ENOMEM);
+    failing = 0;
+    assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+    assert(view.len == long_len + 1 && view.data[0] == 'r');
+    assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+    assert(view.len == 5 && memcmp(view.data, "tail\n", 5) == 0);
+    assert(gnl_reader_next_view(&reader, &view) == GNL_EOF);
+    gnl_reader_destroy(&reader);
+    close(fd);
+}
+
+void test_reader_reserve_recovery() {
+    int fd = open("test_enomem.txt", O_RDONLY);
+    assert(fd != -1);
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_fd(fd)) == 0);
+    assert(gnl_reader_reserve(&reader, long_len + 1) == 0);
+
+    // The first failed copy is served from the reserve
+    failing = 1;
+    char *line = gnl_reader_next(&reader);
+    assert(line && strcmp(line, "short\n") == 0);
+    free(line);
+
+    // With the reserve spent the line is put back, not dropped
+    size_t lines = reader.lines;
+    assert(gnl_reader_next(&reader) == NULL && errno == ENOMEM);
+    assert(reader.lines == lines && reader.offset == 6);
+    failing = 0;
+    line = gnl_reader_next(&reader);
+    assert(line && strlen(line) == long_len + 1);
+    free(line);
+
+    // ...and the reserve is replenished for the next failure
+    failing = 1;
+    line = gnl_reader_next(&reader);
+    assert(line && strcmp(line, "tail\n") == 0);
+    free(line);
+    failing = 0;
+    assert(gnl_reader_next(&reader) == NULL);
+    gnl_reader_destroy(&reader);
+    close(fd);
+}
+
+void test_get_next_line_recovery() {
+    FILE *file = fopen("test_enomem_gnl.txt", "w");
+    for (int i = 0; i < 200; i++)
+        fprintf(file, "line %d\n", i);
+    fclose(file);
+    int fd = open("test_enomem_gnl.txt", O_RDONLY);
+    assert(fd != -1);
+
+    char expected[32];
+    for (int i = 0; i < 200; i++) {
+        // Every other call first fails to allocate, then resumes in place
+        if (i % 2 == 0) {
+            failing = 1;
+            assert(get_next_line(fd) == NULL);
+            failing = 0;
+        }
+        char *line = get_next_line(fd);
+        snprintf(expected, sizeof(expected), "line %d\n", i);
+        assert(line && strcmp(line, expected) == 0);
+        free(line);
+    }
+
+    // Hitting EOF with nothing pending needs no scratch allocation
+    size_t before = mallocs;
+    assert(get_next_line(fd) == NULL);
+    assert(mallocs == before);
+    close(fd);
+}
+
+void test_intern_insert_failure() {
+    t_gnl_intern table;
+    assert(gnl_intern_init(&table, 2) == 0);
+    t_gnl_line *a = gnl_intern_view(&table, "a\n", 2);
+    t_gnl_line *b = gnl_intern_view(&table, "b\n", 2);
+    assert(a && b && table.count == 2);
+
+    // A failed insert into a full table leaves every entry cached
+    failing = 1;
+    assert(gnl_intern_view(&table, "c\n", 2) == NULL);
+    assert(table.count == 2 && table.tail == a);
+    t_gnl_line *hit = gnl_intern_view(&table, "a\n", 2);
+    assert(hit == a && a->refs == 3);
+    failing = 0;
+
+    gnl_line_release(a);
+    gnl_line_release(b);
+    gnl_line_release(hit);
+    gnl_intern_destroy(&table);
+}
+
+int main() {
+    test_reader_grow_failure();
+    test_reader_reserve_recovery();
+    test_get_next_line_recovery();
+    test_intern_insert_failure();
+
+    printf("All tests passed.\n");
+    return 0;
+}
@@ -0,0 +1,1459 @@
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <zlib.h>
+#include "gnl_reader.h"
+#include "gnl_record.h"
+#include "gnl_index.h"
+#include "gnl_reverse.h"
+#include "gnl_utf8.h"
+#include "gnl_filter.h"
+#include "gnl_pipeline.h"
+#include "gnl_scanner.h"
+#include "gnl_forward.h"
+#include "gnl_writer.h"
+#include "gnl_trace.h"
+#include "gnl_direct.h"
+#include "gnl_checkpoint.h"
+#include "gnl_intern.h"
+#include "gnl_mux.h"
+#include "gnl_batch.h"
+
+// Helper function to create test files
+void create_test_file(const char *filename, const char *content) {
+    FILE *file = fopen(filename, "w");
+    if (file) {
+        fputs(content, file);
+        fclose(file);
+    }
+}
+
+void test_reader_fd() {
+    create_test_file("test_reader_fd.txt", "Hello\nWorld\nno newline");
+
+    int fd = open("test_reader_fd.txt", O_RDONLY);
+    assert(fd != -1);
+
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_fd(fd)) == 0);
+
+    char *line = gnl_reader_next(&reader);
+    assert(line && strcmp(line, "Hello\n") == 0);
+    free(line);
+
+    t_gnl_view view;
+    assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+    assert(view.len == 6 && memcmp(view.data, "World\n", 6) == 0);
+
+    line = gnl_reader_next(&reader);
+    assert(line && strcmp(line, "no newline") == 0);
+    free(line);
+
+    assert(gnl_reader_next(&reader) == NULL);
+    gnl_reader_destroy(&reader);
+    close(fd);
+}
+
+void test_reader_long_lines() {
+    // Lines longer than GNL_BLOCK_SIZE force the buffer to grow
+    const size_t len = GNL_BLOCK_SIZE * 3 + 7;
+    FILE *file = fopen("test_reader_long.txt", "w");
+    for (int n = 0; n < 3; n++) {
+        for (size_t i = 0; i < len; i++)
+            fputc('a' + n, file);
+        fputc('\n', file);
+    }
+    fclose(file);
+
+    int fd = open("test_reader_long.txt", O_RDONLY);
+    assert(fd != -1);
+
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_fd(fd)) == 0);
+    for (int n = 0; n < 3; n++) {
+        t_gnl_view view;
+        assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+        assert(view.len == len + 1);
+        assert(view.data[0] == 'a' + n && view.data[len - 1] == 'a' + n);
+        assert(view.data[len] == '\n');
+    }
+    t_gnl_view view;
+    assert(gnl_reader_next_view(&reader, &view) == GNL_EOF);
+    gnl_reader_destroy(&reader);
+    close(fd);
+}
+
+void test_reader_gzip() {
+    // Two concatenated gzip members, like `cat a.gz b.gz`
+    gzFile gz = gzopen("test_reader.gz", "wb");
+    for (int i = 0; i < 10000; i++)
+        gzprintf(gz, "line %d\n", i);
+    gzclose(gz);
+    gz = gzopen("test_reader.gz", "ab");
+    gzputs(gz, "last member\n");
+    gzclose(gz);
+
+    int fd = open("test_reader.gz", O_RDONLY);
+    assert(fd != -1);
+
+    t_gnl_source src;
+    assert(gnl_source_gzip(fd, &src) == 0);
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, src) == 0);
+
+    char expected[32];
+    for (int i = 0; i < 10000; i++) {
+        char *line = gnl_reader_next(&reader);
+        snprintf(expected, sizeof(expected), "line %d\n", i);
+        assert(line && strcmp(line, expected) == 0);
+        free(line);
+    }
+    char *line = gnl_reader_next(&reader);
+    assert(line && strcmp(line, "last member\n") == 0);
+    free(line);
+
+    assert(gnl_reader_next(&reader) == NULL);
+    gnl_reader_destroy(&reader);
+    close(fd);
+}
+
+void test_reader_gzip_truncated() {
+    gzFile gz = gzopen("test_truncated.gz", "wb");
+    for (int i = 0; i < 100000; i++)
+        gzprintf(gz, "line %d\n", i);
+    gzclose(gz);
+
+    // Cut the member in half: the reader must not report a clean EOF
+    struct stat st;
+    assert(stat("test_truncated.gz", &st) == 0);
+    assert(truncate("test_truncated.gz", st.st_size / 2) == 0);
+    int fd = open("test_truncated.gz", O_RDONLY);
+    assert(fd != -1);
+
+    t_gnl_source src;
+    assert(gnl_source_gzip(fd, &src) == 0);
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, src) == 0);
+    t_gnl_view view;
+    int ret;
+    size_t lines = 0;
+    while ((ret = gnl_reader_next_view(&reader, &view)) == GNL_LINE)
+        lines++;
+    assert(ret == GNL_ERROR);
+    assert(lines > 0 && lines < 100000);
+    gnl_reader_destroy(&reader);
+    close(fd);
+}
+
+void test_reader_memory() {
+    const char payload[] = "alpha\nbeta\n\ngamma";
+
+    t_gnl_reader reader;
+    gnl_reader_init_mem(&reader, payload, strlen(payload));
+
+    // Views point straight into the caller's memory
+    t_gnl_view view;
+    assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+    assert(view.data == payload && view.len == 6);
+    assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+    assert(view.data == payload + 6 && view.len == 5);
+    assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+    assert(view.len == 1 && view.data[0] == '\n');
+    assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+    assert(view.len == 5 && memcmp(view.data, "gamma", 5) == 0);
+    assert(gnl_reader_next_view(&reader, &view) == GNL_EOF);
+    gnl_reader_destroy(&reader);
+}
+
+void test_reader_file() {
+    create_test_file("test_reader_file.txt", "one\ntwo\n");
+
+    FILE *file = fopen("test_reader_file.txt", "r");
+    assert(file);
+
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_file(file)) == 0);
+
+    char *line = gnl_reader_next(&reader);
+    assert(line && strcmp(line, "one\n") == 0);
+    free(line);
+    line = gnl_reader_next(&reader);
+    assert(line && strcmp(line, "two\n") == 0);
+    free(line);
+    assert(gnl_reader_next(&reader) == NULL);
+    gnl_reader_destroy(&reader);
+    fclose(file);
+}
+
+// Callback source that hands out its payload one byte per call
+typedef struct {
+    const char *data;
+    size_t pos;
+} trickle_ctx;
+
+ssize_t trickle_read(void *ctx, char *dst, size_t size) {
+    trickle_ctx *t = ctx;
+    if (size == 0 || t->data[t->pos] == '\0')
+        return 0;
+    dst[0] = t->data[t->pos++];
+    return 1;
+}
+
+void test_reader_callback() {
+    trickle_ctx ctx = {"first\nsecond\n", 0};
+
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_callback(trickle_read, &ctx)) == 0);
+
+    char *line = gnl_reader_next(&reader);
+    assert(line && strcmp(line, "first\n") == 0);
+    free(line);
+    line = gnl_reader_next(&reader);
+    assert(line && strcmp(line, "second\n") == 0);
+    free(line);
+    assert(gnl_reader_next(&reader) == NULL);
+    gnl_reader_destroy(&reader);
+}
+
+// Helper to compare one field of a record against an expected string
+int field_is(t_gnl_record *rec, size_t i, const char *expected) {
+    t_gnl_field *f = &rec->fields[i];
+    return f->len == strlen(expected)
+        && memcmp(rec->line.data + f->start, expected, f->len) == 0;
+}
+
+void test_record_tsv() {
+    const char payload[] = "a\tbb\t\tccc\nsingle\n\tx\r\n";
+
+    t_gnl_reader reader;
+    gnl_reader_init_mem(&reader, payload, strlen(payload));
+    t_gnl_record rec;
+    assert(gnl_record_init(&rec, '\t', 0) == 0);
+
+    assert(gnl_reader_next_record(&reader, &rec) == GNL_LINE);
+    assert(rec.nfields == 4);
+    assert(field_is(&rec, 0, "a") && field_is(&rec, 1, "bb"));
+    assert(field_is(&rec, 2, "") && field_is(&rec, 3, "ccc"));
+    assert(rec.line.len == 10);
+
+    assert(gnl_reader_next_record(&reader, &rec) == GNL_LINE);
+    assert(rec.nfields == 1 && field_is(&rec, 0, "single"));
+
+    assert(gnl_reader_next_record(&reader, &rec) == GNL_LINE);
+    assert(rec.nfields == 2 && field_is(&rec, 0, "") && field_is(&rec, 1, "x"));
+
+    assert(gnl_reader_next_record(&reader, &rec) == GNL_EOF);
+    gnl_record_destroy(&rec);
+    gnl_reader_destroy(&reader);
+}
+
+void test_record_csv_quoted() {
+    // Quoted fields may hold delimiters, doubled quotes and newlines
+    create_test_file("test_record.csv",
+        "id,name,note\n"
+        "1,\"Smith, J\",\"said \"\"hi\"\"\"\n"
+        "2,\"multi\nline\",last");
+
+    int fd = open("test_record.csv", O_RDONLY);
+    assert(fd != -1);
+
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_fd(fd)) == 0);
+    t_gnl_record rec;
+    assert(gnl_record_init(&rec, ',', 1) == 0);
+
+    assert(gnl_reader_next_record(&reader, &rec) == GNL_LINE);
+    assert(rec.nfields == 3 && field_is(&rec, 2, "note"));
+
+    assert(gnl_reader_next_record(&reader, &rec) == GNL_LINE);
+    assert(rec.nfields == 3);
+    assert(field_is(&rec, 0, "1") && !rec.fields[0].quoted);
+    assert(field_is(&rec, 1, "Smith, J") && rec.fields[1].quoted);
+    assert(field_is(&rec, 2, "said \"\"hi\"\""));
+
+    assert(gnl_reader_next_record(&reader, &rec) == GNL_LINE);
+    assert(rec.nfields == 3);
+    assert(field_is(&rec, 1, "multi\nline") && field_is(&rec, 2, "last"));
+
+    assert(gnl_reader_next_record(&reader, &rec) == GNL_EOF);
+    gnl_reader_destroy(&reader);
+    close(fd);
+
+    // A quote inside an unquoted field is a literal byte, not an opener
+    const char stray[] = "12\" screen,red,5\nnext,\"a\"b,\"x\nrow\n";
+    gnl_reader_init_mem(&reader, stray, strlen(stray));
+    assert(gnl_reader_next_record(&reader, &rec) == GNL_LINE);
+    assert(rec.nfields == 3 && field_is(&rec, 0, "12\" screen"));
+    assert(!rec.fields[0].quoted && field_is(&rec, 2, "5"));
+    assert(gnl_reader_next_record(&reader, &rec) == GNL_LINE);
+    assert(rec.nfields == 3 && field_is(&rec, 1, "\"a\"b"));
+    assert(field_is(&rec, 2, "\"x\nrow\n") && !rec.fields[2].quoted);
+    assert(gnl_reader_next_record(&reader, &rec) == GNL_EOF);
+    gnl_record_destroy(&rec);
+    gnl_reader_destroy(&reader);
+}
+
+void test_record_many_fields() {
+    // More fields than the initial offset array holds
+    char payload[200] = "";
+    for (int i = 0; i < 40; i++)
+        strcat(payload, i ? ",f" : "f");
+    strcat(payload, "\n");
+
+    t_gnl_reader reader;
+    gnl_reader_init_mem(&reader, payload, strlen(payload));
+    t_gnl_record rec;
+    assert(gnl_record_init(&rec, ',', 1) == 0);
+
+    assert(gnl_reader_next_record(&reader, &rec) == GNL_LINE);
+    assert(rec.nfields == 40 && field_is(&rec, 39, "f"));
+    gnl_record_destroy(&rec);
+    gnl_reader_destroy(&reader);
+}
+
+void test_index_seek() {
+    FILE *file = fopen("test_index.txt", "w");
+    for (int i = 0; i < 5000; i++)
+        fprintf(file, "row %d%s\n", i, i % 7 ? "" : " with a longer tail");
+    fclose(file);
+
+    int fd = open("test_index.txt", O_RDONLY);
+    assert(fd != -1);
+
+    t_gnl_source src;
+    assert(gnl_source_pread(fd, 0, &src) == 0);
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, src) == 0);
+
+    t_gnl_index index;
+    assert(gnl_index_init(&index, 100) == 0);
+    assert(gnl_index_build(&index, &reader) == 0);
+    assert(index.lines == 5000 && index.count == 50);
+
+    // Persist to a sidecar and seek with the reloaded copy
+    assert(gnl_index_save(&index, "test_index.txt.idx", fd) == 0);
+    gnl_index_destroy(&index);
+    assert(gnl_index_load(&index, "test_index.txt.idx", fd) == 0);
+    assert(index.lines == 5000 && index.count == 50 && index.stride == 100);
+
+    // A sidecar cut short, or with a count it cannot hold, is refused
+    t_gnl_index bad;
+    struct stat st;
+    assert(stat("test_index.txt.idx", &st) == 0);
+    assert(truncate("test_index.txt.idx", st.st_size - 1) == 0);
+    assert(gnl_index_load(&bad, "test_index.txt.idx", fd) == GNL_ERROR);
+    assert(bad.offsets == NULL && bad.count == 0);
+    assert(gnl_index_save(&index, "test_index.txt.idx", fd) == 0);
+    int sidecar = open("test_index.txt.idx", O_WRONLY);
+    uint64_t huge = UINT64_MAX;
+    assert(pwrite(sidecar, &huge, sizeof(huge),
+                  offsetof(t_gnl_index_header, count)) == sizeof(huge));
+    close(sidecar);
+    assert(gnl_index_load(&bad, "test_index.txt.idx", fd) == GNL_ERROR);
+    assert(bad.offsets == NULL && bad.count == 0);
+
+    // So is one describing another version of the source file
+    assert(gnl_index_save(&index, "test_index.txt.idx", fd) == 0);
+    int other = open("test_index_other.txt", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    assert(other != -1 && write(other, "row 0\n", 6) == 6);
+    assert(gnl_index_load(&bad, "test_index.txt.idx", other) == GNL_ERROR);
+    assert(bad.offsets == NULL);
+    close(other);
+
+    int targets[] = {0, 99, 100, 2345, 4999, 17};
+    char expected[64];
+    for (size_t t = 0; t < sizeof(targets) / sizeof(targets[0]); t++) {
+        int n = targets[t];
+        assert(gnl_index_seek(&index, &reader, n) == GNL_LINE);
+        char *line = gnl_reader_next(&reader);
+        snprintf(expected, sizeof(expected), "row %d%s\n", n, n % 7 ? "" : " with a longer tail");
+        assert(line && strcmp(line, expected) == 0);
+        free(line);
+    }
+    assert(gnl_index_seek(&index, &reader, 5000) == GNL_LINE);
+    assert(gnl_reader_next(&reader) == NULL);
+    assert(gnl_index_seek(&index, &reader, 5001) == GNL_EOF);
+
+    gnl_index_destroy(&index);
+    gnl_reader_destroy(&reader);
+    close(fd);
+}
+
+void test_reverse_lines() {
+    FILE *file = fopen("test_reverse.txt", "w");
+    for (int i = 0; i < 20000; i++)
+        fprintf(file, "entry %d\n", i);
+    fputs("unterminated", file);
+    fclose(file);
+
+    int fd = open("test_reverse.txt", O_RDONLY);
+    assert(fd != -1);
+
+    t_gnl_rreader reader;
+    assert(gnl_rreader_init(&reader, fd) == 0);
+
+    char *line = gnl_rreader_next(&reader);
+    assert(line && strcmp(line, "unterminated") == 0);
+    free(line);
+
+    char expected[32];
+    for (int i = 19999; i >= 0; i--) {
+        t_gnl_view view;
+        assert(gnl_rreader_next_view(&reader, &view) == GNL_LINE);
+        snprintf(expected, sizeof(expected), "entry %d\n", i);
+        assert(view.len == strlen(expected));
+        assert(memcmp(view.data, expected, view.len) == 0);
+    }
+    assert(gnl_rreader_next(&reader) == NULL);
+    gnl_rreader_destroy(&reader);
+    close(fd);
+}
+
+void test_reverse_long_line() {
+    // A single line spanning several blocks, then a short one
+    const size_t len = GNL_BLOCK_SIZE * 2 + 3;
+    FILE *file = fopen("test_reverse_long.txt", "w");
+    for (size_t i = 0; i < len; i++)
+        fputc('x', file);
+    fputs("\nshort\n", file);
+    fclose(file);
+
+    int fd = open("test_reverse_long.txt", O_RDONLY);
+    assert(fd != -1);
+
+    t_gnl_rreader reader;
+    assert(gnl_rreader_init(&reader, fd) == 0);
+
+    char *line = gnl_rreader_next(&reader);
+    assert(line && strcmp(line, "short\n") == 0);
+    free(line);
+
+    t_gnl_view view;
+    assert(gnl_rreader_next_view(&reader, &view) == GNL_LINE);
+    assert(view.len == len + 1 && view.data[0] == 'x' && view.data[len] == '\n');
+    assert(gnl_rreader_next_view(&reader, &view) == GNL_EOF);
+    gnl_rreader_destroy(&reader);
+    close(fd);
+}
+
+void test_utf8_flags() {
+    const char payload[] =
+        "plain ascii line\n"
+        "caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80\n"
+        "bad \xc0\xaf overlong\n"
+        "surrogate \xed\xa0\x80\n"
+        "cut \xe2\x82";
+
+    t_gnl_reader reader;
+    gnl_reader_init_mem(&reader, payload, sizeof(payload) - 1);
+    t_gnl_view view;
+    t_gnl_utf8 info;
+
+    assert(gnl_reader_next_utf8(&reader, &view, &info) == GNL_LINE);
+    assert(info.valid && info.ascii && info.codepoints == 17 && view.len == 17);
+
+    assert(gnl_reader_next_utf8(&reader, &view, &info) == GNL_LINE);
+    assert(info.valid && !info.ascii && info.codepoints == 9);
+
+    assert(gnl_reader_next_utf8(&reader, &view, &info) == GNL_LINE);
+    assert(!info.valid && !info.ascii);
+
+    assert(gnl_reader_next_utf8(&reader, &view, &info) == GNL_LINE);
+    assert(!info.valid);
+
+    assert(gnl_reader_next_utf8(&reader, &view, &info) == GNL_LINE);
+    assert(!info.valid && view.len == 6);
+
+    assert(gnl_reader_next_utf8(&reader, &view, &info) == GNL_EOF);
+    gnl_reader_destroy(&reader);
+}
+
+void test_utf8_split_reads() {
+    // Multi-byte sequences cut in half by the source must still validate
+    trickle_ctx ctx = {"\xe2\x82\xac\xe2\x82\xac\n\xf0\x9f\x98\x80\n", 0};
+
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_callback(trickle_read, &ctx)) == 0);
+    t_gnl_view view;
+    t_gnl_utf8 info;
+
+    assert(gnl_reader_next_utf8(&reader, &view, &info) == GNL_LINE);
+    assert(info.valid && info.codepoints == 3 && view.len == 7);
+    assert(gnl_reader_next_utf8(&reader, &view, &info) == GNL_LINE);
+    assert(info.valid && info.codepoints == 2 && view.len == 5);
+    assert(gnl_reader_next_utf8(&reader, &view, &info) == GNL_EOF);
+    gnl_reader_destroy(&reader);
+}
+
+void test_filter_literals() {
+    FILE *file = fopen("test_filter.txt", "w");
+    for (int i = 0; i < 50000; i++) {
+        if (i % 1000 == 7)
+            fprintf(file, "%d ERROR disk full\n", i);
+        else if (i % 1000 == 500)
+            fprintf(file, "%d panic: oops\n", i);
+        else
+            fprintf(file, "%d info all good\n", i);
+    }
+    fputs("tail ERROR", file);
+    fclose(file);
+
+    int fd = open("test_filter.txt", O_RDONLY);
+    assert(fd != -1);
+
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_fd(fd)) == 0);
+    const char *patterns[] = {"panic", "ERROR"};
+    t_gnl_filter filter;
+    assert(gnl_filter_init(&filter, patterns, 2) == 0);
+
+    char expected[64];
+    for (int i = 0; i < 50; i++) {
+        t_gnl_view view;
+        assert(gnl_reader_next_match(&reader, &filter, &view) == GNL_LINE);
+        snprintf(expected, sizeof(expected), "%d ERROR disk full\n", i * 1000 + 7);
+        assert(view.len == strlen(expected) && memcmp(view.data, expected, view.len) == 0);
+        // Skipped lines still count towards the reader position
+        assert(reader.lines == (size_t)i * 1000 + 8);
+
+        char *line = gnl_reader_next_matching(&reader, &filter);
+        snprintf(expected, sizeof(expected), "%d panic: oops\n", i * 1000 + 500);
+        assert(line && strcmp(line, expected) == 0);
+        free(line);
+    }
+    char *line = gnl_reader_next_matching(&reader, &filter);
+    assert(line && strcmp(line, "tail ERROR") == 0);
+    free(line);
+    assert(gnl_reader_next_matching(&reader, &filter) == NULL);
+    assert(reader.lines == 50001);
+
+    gnl_filter_destroy(&filter);
+    gnl_reader_destroy(&reader);
+    close(fd);
+
+    // A match cannot span lines, so a literal holding '\n' is refused
+    const char *spanning[] = {"ERROR", "error\n"};
+    assert(gnl_filter_init(&filter, spanning, 2) == GNL_ERROR);
+}
+
+void test_filter_split_match() {
+    // The keyword arrives one byte at a time and straddles every refill
+    trickle_ctx ctx = {"nothing here\nfound the needle!\nneedl\n", 0};
+
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_callback(trickle_read, &ctx)) == 0);
+    const char *patterns[] = {"needle"};
+    t_gnl_filter filter;
+    assert(gnl_filter_init(&filter, patterns, 1) == 0);
+
+    char *line = gnl_reader_next_matching(&reader, &filter);
+    assert(line && strcmp(line, "found the needle!\n") == 0);
+    free(line);
+    assert(gnl_reader_next_matching(&reader, &filter) == NULL);
+    assert(reader.lines == 3);
+
+    gnl_filter_destroy(&filter);
+    gnl_reader_destroy(&reader);
+}
+
+typedef struct {
+    t_gnl_pipeline *pipeline;
+    long lines;
+    long sum;
+} worker_ctx;
+
+void *pipeline_worker(void *arg) {
+    worker_ctx *w = arg;
+    t_gnl_item item;
+    while (gnl_pipeline_pop(w->pipeline, &item) == GNL_LINE) {
+        assert(item.len > 0 && item.data[item.len - 1] == '\n');
+        w->sum += atol(item.data);
+        w->lines++;
+        gnl_pipeline_release(w->pipeline, &item);
+    }
+    return NULL;
+}
+
+void test_pipeline_workers() {
+    const long count = 200000;
+    FILE *file = fopen("test_pipeline.txt", "w");
+    for (long i = 0; i < count; i++)
+        fprintf(file, "%ld payload\n", i);
+    // One line bigger than a slab takes the oversize path
+    fprintf(file, "%10000ld\n", 0L);
+    fclose(file);
+
+    int fd = open("test_pipeline.txt", O_RDONLY);
+    assert(fd != -1);
+
+    // Few small slabs so they have to be recycled many times over
+    t_gnl_pipeline pipeline;
+    assert(gnl_pipeline_start(&pipeline, gnl_source_fd(fd), 4096, 4) == 0);
+
+    pthread_t threads[4];
+    worker_ctx workers[4];
+    for (int i = 0; i < 4; i++) {
+        workers[i] = (worker_ctx){&pipeline, 0, 0};
+        pthread_create(&threads[i], NULL, pipeline_worker, &workers[i]);
+    }
+    long lines = 0, sum = 0;
+    for (int i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL);
+        lines += workers[i].lines;
+        sum += workers[i].sum;
+    }
+    assert(lines == count + 1);
+    assert(sum == count * (count - 1) / 2);
+    assert(gnl_pipeline_join(&pipeline) == 0);
+    close(fd);
+}
+
+void *pipeline_dribble(void *arg) {
+    int fd = *(int *)arg;
+    for (int i = 0; i < 20; i++) {
+        usleep(5000);
+        assert(write(fd, "7\n", 2) == 2);
+    }
+    close(fd);
+    return NULL;
+}
+
+void test_pipeline_parks() {
+    assert(sizeof(t_gnl_cell) == GNL_CACHE_LINE);
+    int fds[2];
+    assert(pipe(fds) == 0);
+
+    // A slow source outlasts the spin, so the workers park until woken
+    t_gnl_pipeline pipeline;
+    assert(gnl_pipeline_start(&pipeline, gnl_source_fd(fds[0]), 64, 2) == 0);
+    pthread_t writer;
+    pthread_create(&writer, NULL, pipeline_dribble, &fds[1]);
+    pthread_t threads[2];
+    worker_ctx workers[2];
+    for (int i = 0; i < 2; i++) {
+        workers[i] = (worker_ctx){&pipeline, 0, 0};
+        pthread_create(&threads[i], NULL, pipeline_worker, &workers[i]);
+    }
+    pthread_join(writer, NULL);
+    for (int i = 0; i < 2; i++)
+        pthread_join(threads[i], NULL);
+    assert(workers[0].lines + workers[1].lines == 20);
+    assert(workers[0].sum + workers[1].sum == 140);
+    assert(gnl_pipeline_join(&pipeline) == 0);
+    close(fds[0]);
+}
+
+typedef struct {
+    atomic_long lines[3];
+    atomic_long sum[3];
+} scan_totals;
+
+int scan_count_line(void *ctx, size_t file, const t_gnl_view *line) {
+    scan_totals *totals = ctx;
+    assert(line->len > 0 && line->data[line->len - 1] == '\n');
+    atomic_fetch_add(&totals->lines[file], 1);
+    atomic_fetch_add(&totals->sum[file], atol(line->data));
+    return 0;
+}
+
+void test_scan_files() {
+    // Wildly different sizes so chunks have to be stolen to balance
+    const char *paths[] = {"test_scan_big.txt", "test_scan_small.txt", "test_scan_empty.txt"};
+    const long counts[] = {300000, 10, 0};
+    for (int f = 0; f < 3; f++) {
+        FILE *file = fopen(paths[f], "w");
+        for (long i = 0; i < counts[f]; i++)
+            fprintf(file, "%ld%*s\n", i, (int)(i % 50), "");
+        fclose(file);
+    }
+
+    scan_totals totals;
+    for (int f = 0; f < 3; f++) {
+        atomic_init(&totals.lines[f], 0);
+        atomic_init(&totals.sum[f], 0);
+    }
+    t_gnl_scan_cfg cfg = {4, 100000, scan_count_line, &totals};
+    assert(gnl_scan_files(paths, 3, &cfg) == 0);
+
+    for (int f = 0; f < 3; f++) {
+        assert(atomic_load(&totals.lines[f]) == counts[f]);
+        assert(atomic_load(&totals.sum[f]) == counts[f] * (counts[f] - 1) / 2);
+    }
+
+    const char *missing[] = {"test_scan_small.txt", "does_not_exist.txt"};
+    assert(gnl_scan_files(missing, 2, &cfg) == GNL_ERROR);
+
+    // Zero threads means one per online CPU
+    cfg.nthreads = 0;
+    atomic_store(&totals.lines[0], 0);
+    assert(gnl_scan_files(paths + 1, 1, &cfg) == 0);
+    assert(atomic_load(&totals.lines[0]) == counts[1]);
+
+    // A full deque refuses new tasks instead of overwriting old ones
+    t_gnl_deque deque;
+    t_gnl_task task = {0, 0, 1};
+    assert(gnl_deque_init(&deque, 2) == 0);
+    assert(gnl_deque_push(&deque, &task) && gnl_deque_push(&deque, &task));
+    assert(!gnl_deque_push(&deque, &task));
+    assert(gnl_deque_steal(&deque, &task) == 1);
+    assert(gnl_deque_push(&deque, &task));
+    gnl_deque_destroy(&deque);
+}
+
+// Helper that reads a whole file back into a static buffer
+const char *slurp(const char *filename) {
+    static char content[4096];
+    FILE *file = fopen(filename, "r");
+    size_t len = fread(content, 1, sizeof(content) - 1, file);
+    content[len] = '\0';
+    fclose(file);
+    return content;
+}
+
+// Relaying a log into a non-blocking socket: a full socket is GNL_AGAIN,
+// and bytes already sent are reported instead of being lost in an error
+void test_forward_file_partial() {
+    FILE *file = fopen("test_forward_src.txt", "w");
+    for (int i = 0; i < 200000; i++)
+        fprintf(file, "line %d\n", i);
+    fclose(file);
+    int src = open("test_forward_src.txt", O_RDONLY);
+    int sv[2];
+    assert(src != -1 && socketpair(AF_UNIX, SOCK_STREAM, 0, sv) == 0);
+    fcntl(sv[0], F_SETFL, O_NONBLOCK);
+    struct stat st;
+    assert(fstat(src, &st) == 0);
+
+    size_t size = (size_t)st.st_size, got = 0;
+    char *copy = malloc(size);
+    off_t pos = 0;
+    int again = 0;
+    while (pos < st.st_size) {
+        ssize_t ret = gnl_forward_file(src, sv[0], &pos);
+        assert(ret > 0 || ret == GNL_AGAIN);
+        if (ret == GNL_AGAIN) {
+            ssize_t n = read(sv[1], copy + got, size - got);
+            assert(n > 0);
+            got += n;
+            again++;
+        }
+    }
+    while (got < size) {
+        ssize_t n = read(sv[1], copy + got, size - got);
+        assert(n > 0);
+        got += n;
+    }
+    assert(again > 0 && got == size);
+    char *expect = malloc(size);
+    assert(pread(src, expect, size, 0) == (ssize_t)size);
+    assert(memcmp(copy, expect, size) == 0);
+    free(expect);
+    free(copy);
+    close(sv[0]);
+    close(sv[1]);
+    close(src);
+}
+
+void test_forward_file() {
+    create_test_file("test_forward_src.txt", "a\nbb\nccc");
+
+    int src = open("test_forward_src.txt", O_RDONLY);
+    int dst = open("test_forward_dst.txt", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    assert(src != -1 && dst != -1);
+
+    // The unterminated tail stays behind until its newline shows up
+    off_t pos = 0;
+    assert(gnl_forward_file(src, dst, &pos) == 5 && pos == 5);
+    assert(gnl_forward_file(src, dst, &pos) == 0 && pos == 5);
+    assert(strcmp(slurp("test_forward_dst.txt"), "a\nbb\n") == 0);
+
+    FILE *file = fopen("test_forward_src.txt", "a");
+    fputs("!\ndd", file);
+    fclose(file);
+    assert(gnl_forward_file(src, dst, &pos) == 5 && pos == 10);
+    assert(strcmp(slurp("test_forward_dst.txt"), "a\nbb\nccc!\n") == 0);
+
+    close(src);
+    close(dst);
+    test_forward_file_partial();
+}
+
+// A full non-blocking destination takes part of a line; the rest is
+// forwarded on the next call without repeating any byte
+void test_forward_stream_partial() {
+    FILE *file = fopen("test_forward_src.txt", "w");
+    for (int i = 0; i < 20000; i++)
+        fprintf(file, "line %d\n", i);
+    fclose(file);
+    int src = open("test_forward_src.txt", O_RDONLY);
+    int out[2];
+    assert(src != -1 && pipe(out) == 0);
+    fcntl(out[1], F_SETFL, O_NONBLOCK);
+
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_fd(src)) == 0);
+    size_t cap = 1 << 20, got = 0;
+    char *copy = malloc(cap);
+    ssize_t ret;
+    int again = 0;
+    while ((ret = gnl_forward_stream(&reader, out[1])) != GNL_EOF) {
+        assert(ret > 0 || ret == GNL_AGAIN);
+        if (ret == GNL_AGAIN) {
+            ssize_t n = read(out[0], copy + got, cap - got);
+            assert(n > 0);
+            got += n;
+            again++;
+        }
+    }
+    while (got < (size_t)reader.offset) {
+        ssize_t n = read(out[0], copy + got, cap - got);
+        assert(n > 0);
+        got += n;
+    }
+    assert(again > 0);
+    assert(got == (size_t)reader.offset && reader.lines == 20000);
+    file = fopen("test_forward_src.txt", "r");
+    char *expect = malloc(cap);
+    assert(fread(expect, 1, cap, file) == got);
+    assert(memcmp(copy, expect, got) == 0);
+    fclose(file);
+    free(expect);
+    free(copy);
+    gnl_reader_destroy(&reader);
+    close(out[0]);
+    close(out[1]);
+    close(src);
+}
+
+void test_forward_stream() {
+    int pipefd[2];
+    assert(pipe(pipefd) == 0);
+    int dst = open("test_forward_stream.txt", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    assert(dst != -1);
+
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_fd(pipefd[0])) == 0);
+
+    assert(write(pipefd[1], "one\ntw", 6) == 6);
+    assert(gnl_forward_stream(&reader, dst) == 4);
+    assert(write(pipefd[1], "o\nthree\npartial", 15) == 15);
+    close(pipefd[1]);
+    assert(gnl_forward_stream(&reader, dst) == 10);
+    assert(gnl_forward_stream(&reader, dst) == GNL_EOF);
+    assert(reader.lines == 3 && reader.offset == 14);
+    assert(strcmp(slurp("test_forward_stream.txt"), "one\ntwo\nthree\n") == 0);
+
+    // The incomplete last line is still there for the caller
+    t_gnl_view view;
+    assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+    assert(view.len == 7 && memcmp(view.data, "partial", 7) == 0);
+
+    gnl_reader_destroy(&reader);
+    close(pipefd[0]);
+    test_forward_stream_partial();
+    close(dst);
+}
+
+void test_writer_batches() {
+    // Lines bigger than the whole buffer force recycling mid-batch
+    FILE *file = fopen("test_writer_src.txt", "w");
+    for (int i = 0; i < 30000; i++)
+        fprintf(file, "%d %s\n", i, i % 10000 ? "short" : "");
+    for (int i = 0; i < GNL_BLOCK_SIZE + 10; i++)
+        fputc('L', file);
+    fputs("\nend\n", file);
+    fclose(file);
+
+    int src = open("test_writer_src.txt", O_RDONLY);
+    int dst = open("test_writer_dst.txt", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    assert(src != -1 && dst != -1);
+
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_fd(src)) == 0);
+    t_gnl_writer writer;
+    t_gnl_writer_cfg cfg = {8, 1 << 20, 0};
+    assert(gnl_writer_init(&writer, dst, &cfg) == 0);
+    gnl_writer_attach(&writer, &reader, src);
+
+    t_gnl_view view;
+    while (gnl_reader_next_view(&reader, &view) == GNL_LINE)
+        assert(gnl_writer_add(&writer, &view) == 0);
+    assert(gnl_writer_destroy(&writer) == 0);
+    gnl_reader_destroy(&reader);
+    close(src);
+    close(dst);
+
+    // The copy must be byte-for-byte identical
+    FILE *a = fopen("test_writer_src.txt", "r");
+    FILE *b = fopen("test_writer_dst.txt", "r");
+    int ca, cb;
+    do {
+        ca = fgetc(a);
+        cb = fgetc(b);
+        assert(ca == cb);
+    } while (ca != EOF);
+    fclose(a);
+    fclose(b);
+}
+
+typedef struct {
+    t_gnl_reader *reader;
+    t_gnl_writer *writer;
+} writer_pump;
+
+void *writer_pump_run(void *arg) {
+    writer_pump *p = arg;
+    t_gnl_view view;
+    while (gnl_reader_next_view(p->reader, &view) == GNL_LINE)
+        assert(gnl_writer_add(p->writer, &view) == 0);
+    return NULL;
+}
+
+void test_writer_latency() {
+    int in[2], out[2];
+    assert(pipe(in) == 0 && pipe(out) == 0);
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_fd(in[0])) == 0);
+    t_gnl_writer writer;
+    t_gnl_writer_cfg cfg = {8, 1 << 20, 20000};
+    assert(gnl_writer_init(&writer, out[1], &cfg) == 0);
+    gnl_writer_attach(&writer, &reader, in[0]);
+    writer_pump pump = {&reader, &writer};
+    pthread_t thread;
+    pthread_create(&thread, NULL, writer_pump_run, &pump);
+
+    // The pump is about to block on an idle source: the line must still
+    // come out within the latency bound, not when more input arrives
+    char got[16];
+    assert(write(in[1], "first\n", 6) == 6);
+    struct pollfd pfd = {out[0], POLLIN, 0};
+    assert(poll(&pfd, 1, 2000) == 1);
+    assert(read(out[0], got, sizeof(got)) == 6 && memcmp(got, "first\n", 6) == 0);
+
+    assert(write(in[1], "second\n", 7) == 7);
+    close(in[1]);
+    pthread_join(thread, NULL);
+    assert(gnl_writer_destroy(&writer) == 0);
+    assert(read(out[0], got, sizeof(got)) == 7 && memcmp(got, "second\n", 7) == 0);
+    gnl_reader_destroy(&reader);
+    close(in[0]);
+    close(out[0]);
+    close(out[1]);
+
+    // Growing the buffer for a reserve flushes lines that point into it
+    int src = open("test_writer_src.txt", O_RDONLY);
+    int dst = open("test_writer_dst.txt", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    assert(src != -1 && dst != -1);
+    assert(gnl_reader_init(&reader, gnl_source_fd(src)) == 0);
+    cfg.max_latency_us = 10000000;
+    assert(gnl_writer_init(&writer, dst, &cfg) == 0);
+    gnl_writer_attach(&writer, &reader, src);
+    t_gnl_view view;
+    for (int i = 0; i < 2; i++) {
+        assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+        assert(gnl_writer_add(&writer, &view) == 0);
+    }
+    assert(writer.count == 1);
+    assert(gnl_reader_reserve(&reader, GNL_BLOCK_SIZE * 4) == 0);
+    assert(writer.count == 0);
+    assert(strcmp(slurp("test_writer_dst.txt"), "0 \n1 short\n") == 0);
+    assert(gnl_writer_destroy(&writer) == 0);
+    gnl_reader_destroy(&reader);
+    close(src);
+    close(dst);
+}
+
+void test_reader_reserve() {
+    const size_t len = GNL_BLOCK_SIZE * 2 + 3;
+    FILE *file = fopen("test_reader_reserve.txt", "w");
+    fputs("short\n", file);
+    for (size_t i = 0; i < len; i++)
+        fputc('r', file);
+    fputc('\n', file);
+    fclose(file);
+
+    int fd = open("test_reader_reserve.txt", O_RDONLY);
+    assert(fd != -1);
+
+    // Reserving sizes the buffer up front and keeps a spare line block
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_fd(fd)) == 0);
+    assert(gnl_reader_reserve(&reader, len + 1) == 0);
+    assert(reader.cap >= len + 1 && reader.reserve != NULL);
+    assert(reader.reserve_size == len + 1);
+
+    // An undelivered line can be pushed back and read again
+    t_gnl_view view;
+    assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+    assert(view.len == 6 && reader.lines == 1 && reader.offset == 6);
+    gnl_reader_unread(&reader, &view);
+    assert(reader.lines == 0 && reader.offset == 0);
+
+    char *line = gnl_reader_next(&reader);
+    assert(line && strcmp(line, "short\n") == 0);
+    free(line);
+    size_t cap = reader.cap;
+    line = gnl_reader_next(&reader);
+    assert(line && strlen(line) == len + 1 && line[len - 1] == 'r');
+    assert(reader.cap == cap);
+    free(line);
+    assert(gnl_reader_next(&reader) == NULL);
+    gnl_reader_destroy(&reader);
+    close(fd);
+}
+
+#ifdef GNL_TRACE
+void test_trace_phases() {
+    FILE *file = fopen("test_trace.txt", "w");
+    for (int i = 0; i < 1000; i++)
+        fprintf(file, "trace line %d\n", i);
+    fclose(file);
+
+    int fd = open("test_trace.txt", O_RDONLY);
+    assert(fd != -1);
+
+    t_gnl_reader reader;
+    t_gnl_trace trace;
+    assert(gnl_reader_init(&reader, gnl_source_fd(fd)) == 0);
+    gnl_trace_attach(&trace, &reader);
+    char *line;
+    int count = 0;
+    while ((line = gnl_trace_next(&reader, &trace)) != NULL) {
+        free(line);
+        count++;
+    }
+    assert(count == 1000);
+    assert(trace.hist[GNL_TRACE_COPY].count == 1000);
+    assert(trace.hist[GNL_TRACE_SCAN].count == 1001);
+    assert(trace.hist[GNL_TRACE_WAIT].count >= 2);
+    assert(trace.hist[GNL_TRACE_WAIT].sum == trace.waited);
+    gnl_reader_destroy(&reader);
+    close(fd);
+
+    // Exact values below the sub-bucket count, bounded error above it
+    memset(&trace, 0, sizeof(trace));
+    for (uint64_t ns = 1; ns <= 1000; ns++)
+        gnl_trace_record(&trace, GNL_TRACE_SCAN, ns);
+    assert(trace.hist[GNL_TRACE_SCAN].min == 1);
+    assert(trace.hist[GNL_TRACE_SCAN].max == 1000);
+    assert(trace.hist[GNL_TRACE_SCAN].counts[7] == 1);
+
+    int fds[2];
+    assert(pipe(fds) == 0);
+    assert(gnl_trace_export(&trace, fds[1]) == 0);
+    close(fds[1]);
+    char text[1024];
+    ssize_t n = read(fds[0], text, sizeof(text) - 1);
+    close(fds[0]);
+    assert(n > 0);
+    text[n] = '\0';
+    assert(strncmp(text, "phase", 5) == 0);
+    char *scan = strstr(text, "\nscan");
+    assert(scan && strstr(text, "\nwait") && strstr(text, "\ncopy"));
+    unsigned long long cnt, min, p50;
+    assert(sscanf(scan + 1, "scan %llu %llu %llu", &cnt, &min, &p50) == 3);
+    assert(cnt == 1000 && min == 1 && p50 >= 470 && p50 <= 500);
+}
+#endif
+
+ssize_t stale_errno_read(void *ctx, char *dst, size_t size) {
+    (void)dst;
+    (void)size;
+    errno = EAGAIN;
+    return *(int *)ctx ? GNL_AGAIN : GNL_ERROR;
+}
+
+void test_reader_nonblocking() {
+    int fds[2];
+    assert(pipe(fds) == 0);
+    fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_fd(fds[0])) == 0);
+
+    // An empty pipe reports GNL_AGAIN and a partial line is kept
+    t_gnl_view view;
+    assert(gnl_reader_next_view(&reader, &view) == GNL_AGAIN);
+    assert(write(fds[1], "par", 3) == 3);
+    assert(gnl_reader_next_view(&reader, &view) == GNL_AGAIN);
+    assert(write(fds[1], "tial\nnext", 9) == 9);
+    assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+    assert(view.len == 8 && memcmp(view.data, "partial\n", 8) == 0);
+    assert(gnl_reader_next_view(&reader, &view) == GNL_AGAIN);
+    close(fds[1]);
+    assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+    assert(view.len == 4 && memcmp(view.data, "next", 4) == 0);
+    assert(gnl_reader_next_view(&reader, &view) == GNL_EOF);
+    gnl_reader_destroy(&reader);
+    close(fds[0]);
+
+    // Only an explicit GNL_AGAIN from the source means "try again": a
+    // failing source that leaves a stale EAGAIN in errno is an error
+    int again = 1;
+    assert(gnl_reader_init(&reader, gnl_source_callback(stale_errno_read, &again)) == 0);
+    assert(gnl_reader_next_view(&reader, &view) == GNL_AGAIN);
+    again = 0;
+    assert(gnl_reader_next_view(&reader, &view) == GNL_ERROR);
+    gnl_reader_destroy(&reader);
+}
+
+void test_reader_direct() {
+    FILE *file = fopen("test_reader_direct.txt", "w");
+    off_t offsets[2000];
+    off_t pos = 0;
+    for (int i = 0; i < 2000; i++) {
+        offsets[i] = pos;
+        pos += fprintf(file, "direct %d %.*s\n", i, i % 50,
+            "..................................................");
+    }
+    // Unaligned tail without a final newline
+    fputs("tail", file);
+    fclose(file);
+
+    // A tiny block forces many refills and lines that straddle blocks
+    t_gnl_source src;
+    assert(gnl_source_direct("test_reader_direct.txt", 100, &src) == 0);
+    t_gnl_direct *d = (t_gnl_direct *)src.ctx;
+    assert(d->size == GNL_DIRECT_ALIGN);
+    assert(((size_t)d->block & (GNL_DIRECT_ALIGN - 1)) == 0);
+
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, src) == 0);
+    char expect[128];
+    t_gnl_view view;
+    for (int i = 0; i < 2000; i++) {
+        int len = snprintf(expect, sizeof(expect), "direct %d %.*s\n", i,
+            i % 50, "..................................................");
+        assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+        assert(view.len == (size_t)len && memcmp(view.data, expect, len) == 0);
+    }
+    assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+    assert(view.len == 4 && memcmp(view.data, "tail", 4) == 0);
+    assert(gnl_reader_next_view(&reader, &view) == GNL_EOF);
+
+    // Seeking to an unaligned offset skips the head of the aligned block
+    assert(gnl_reader_seek(&reader, offsets[1234], 1234) == 0);
+    assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+    assert(memcmp(view.data, "direct 1234 ", 12) == 0);
+    assert(reader.lines == 1235);
+    gnl_reader_destroy(&reader);
+
+    // An aligned buffer smaller than the source block still goes through
+    // the staging block, so every read stays one large block
+    assert(gnl_source_direct("test_reader_direct.txt", 0, &src) == 0);
+    assert(gnl_reader_init(&reader, src) == 0);
+    assert(gnl_reader_align(&reader, 3000) == GNL_ERROR);
+    assert(gnl_reader_align(&reader, GNL_DIRECT_ALIGN) == 0);
+    assert(((size_t)reader.buf & (GNL_DIRECT_ALIGN - 1)) == 0);
+    assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+    assert(((t_gnl_direct *)src.ctx)->tail > 0);
+    gnl_reader_destroy(&reader);
+
+    // A reader sized to the block lets the source read straight into it:
+    // the staging block stays unused, even across carried-over lines
+    assert(gnl_reader_init_direct(&reader, "test_reader_direct.txt",
+        2 * GNL_DIRECT_ALIGN) == 0);
+    t_gnl_direct *sized = (t_gnl_direct *)reader.src.ctx;
+    assert(((size_t)reader.buf & (GNL_DIRECT_ALIGN - 1)) == 0);
+    assert(reader.cap >= sized->size + GNL_BLOCK_SIZE);
+    for (int i = 0; i < 2000; i++) {
+        int len = snprintf(expect, sizeof(expect), "direct %d %.*s\n", i,
+            i % 50, "..................................................");
+        assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+        assert(view.len == (size_t)len && memcmp(view.data, expect, len) == 0);
+    }
+    assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+    assert(view.len == 4 && memcmp(view.data, "tail", 4) == 0);
+    assert(gnl_reader_next_view(&reader, &view) == GNL_EOF);
+    assert(sized->tail == 0);
+    gnl_reader_destroy(&reader);
+
+    assert(gnl_source_direct("test_reader_direct_missing.txt", 0, &src)
+        == GNL_ERROR);
+}
+
+void test_checkpoint_resume() {
+    FILE *file = fopen("test_checkpoint.txt", "w");
+    for (int i = 0; i < 100; i++)
+        fprintf(file, "record %d\n", i);
+    fclose(file);
+
+    int fd = open("test_checkpoint.txt", O_RDONLY);
+    assert(fd != -1);
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_fd(fd)) == 0);
+    t_gnl_view view;
+    for (int i = 0; i < 40; i++)
+        assert(gnl_reader_next_view(&reader, &view) == GNL_LINE);
+    t_gnl_checkpoint cp;
+    assert(gnl_checkpoint_take(&reader, fd, &cp) == 0);
+    assert(cp.lines == 40 && cp.offset == (uint64_t)reader.offset);
+    assert(gnl_checkpoint_save(&cp, "test_checkpoint.ckp") == 0);
+    gnl_reader_destroy(&reader);
+    close(fd);
+
+    // A fresh process picks up at the next unconsumed line
+    t_gnl_checkpoint loaded;
+    assert(gnl_checkpoint_load(&loaded, "test_checkpoint.ckp") == 0);
+    fd = open("test_checkpoint.txt", O_RDONLY);
+    assert(gnl_reader_init(&reader, gnl_source_fd(fd)) == 0);
+    assert(gnl_checkpoint_resume(&reader, fd, &loaded) == 0);
+    char *line = gnl_reader_next(&reader);
+    assert(line && strcmp(line, "record 40\n") == 0);
+    assert(reader.lines == 41);
+    free(line);
+    gnl_reader_destroy(&reader);
+    close(fd);
+
+    // A rewritten file is detected instead of resumed blindly
+    create_test_file("test_checkpoint.new", "other\n");
+    assert(rename("test_checkpoint.new", "test_checkpoint.txt") == 0);
+    fd = open("test_checkpoint.txt", O_RDONLY);
+    assert(gnl_reader_init(&reader, gnl_source_fd(fd)) == 0);
+    errno = 0;
+    assert(gnl_checkpoint_resume(&reader, fd, &loaded) == GNL_ERROR);
+    assert(errno == ESTALE);
+    gnl_reader_destroy(&reader);
+    close(fd);
+}
+
+void test_intern_lines() {
+    const char payload[] = "GET /\nGET /a\nGET /\nPOST /\nGET /\nGET /a\n";
+
+    t_gnl_reader reader;
+    gnl_reader_init_mem(&reader, payload, strlen(payload));
+    t_gnl_intern table;
+    assert(gnl_intern_init(&table, 2) == 0);
+
+    // Repeated lines share one handle and carry their hash
+    t_gnl_line *first = gnl_reader_next_interned(&reader, &table);
+    t_gnl_line *other = gnl_reader_next_interned(&reader, &table);
+    t_gnl_line *again = gnl_reader_next_interned(&reader, &table);
+    assert(first && other && first == again);
+    assert(strcmp(first->data, "GET /\n") == 0 && first->len == 6);
+    assert(first->hash == gnl_hash("GET /\n", 6));
+    assert(first->hash != other->hash && first->refs == 3);
+
+    // POST evicts the least recent entry; held handles stay valid
+    t_gnl_line *post = gnl_reader_next_interned(&reader, &table);
+    assert(table.count == 2 && other->refs == 1);
+    assert(strcmp(other->data, "GET /a\n") == 0);
+    t_gnl_line *hit = gnl_reader_next_interned(&reader, &table);
+    assert(hit == first && first->refs == 4);
+    t_gnl_line *fresh = gnl_reader_next_interned(&reader, &table);
+    assert(fresh != other && strcmp(fresh->data, "GET /a\n") == 0);
+    assert(gnl_reader_next_interned(&reader, &table) == NULL);
+    assert(reader.lines == 6);
+
+    gnl_line_release(first);
+    gnl_line_release(again);
+    gnl_line_release(hit);
+    gnl_line_release(other);
+    gnl_line_release(post);
+    gnl_line_release(fresh);
+    gnl_intern_destroy(&table);
+    gnl_reader_destroy(&reader);
+}
+
+void *mux_trickle(void *arg) {
+    int fd = *(int *)arg;
+    for (int i = 0; i < 60; i++) {
+        usleep(5000);
+        assert(write(fd, "x", 1) == 1);
+    }
+    assert(write(fd, "\n", 1) == 1);
+    close(fd);
+    return NULL;
+}
+
+void test_mux_deadline() {
+    int fds[2];
+    assert(pipe(fds) == 0);
+    t_gnl_mux mux;
+    assert(gnl_mux_init(&mux, fds, 1, 0) == 0);
+    assert(fcntl(fds[0], F_GETFL) & O_NONBLOCK);
+    pthread_t writer;
+    pthread_create(&writer, NULL, mux_trickle, &fds[1]);
+
+    // A source that keeps waking poll without finishing a line must not
+    // stretch the timeout: it bounds the whole call, not each poll
+    struct timespec start, now;
+    size_t which;
+    t_gnl_view view;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    assert(gnl_mux_next(&mux, &which, &view, 50) == GNL_AGAIN);
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    long elapsed_ms = (now.tv_sec - start.tv_sec) * 1000
+        + (now.tv_nsec - start.tv_nsec) / 1000000;
+    assert(elapsed_ms < 200);
+
+    pthread_join(writer, NULL);
+    assert(gnl_mux_next(&mux, &which, &view, -1) == GNL_LINE);
+    assert(which == 0 && view.len == 61 && view.data[60] == '\n');
+    assert(gnl_mux_next(&mux, &which, &view, -1) == GNL_EOF);
+
+    // The descriptor goes back to blocking mode once the mux is done
+    gnl_mux_destroy(&mux);
+    assert(!(fcntl(fds[0], F_GETFL) & O_NONBLOCK));
+    close(fds[0]);
+}
+
+void test_mux_fairness() {
+    // One tenant streams a 4 MB line, the other sends short lines
+    const size_t len = 4 << 20;
+    FILE *file = fopen("test_mux_noisy.txt", "w");
+    for (size_t i = 0; i < len; i++)
+        fputc('n', file);
+    fputc('\n', file);
+    fclose(file);
+
+    int fds[2];
+    fds[0] = open("test_mux_noisy.txt", O_RDONLY);
+    assert(fds[0] != -1);
+    int quiet[2];
+    assert(pipe(quiet) == 0);
+    fds[1] = quiet[0];
+    assert(write(quiet[1], "q1\nq2\n", 6) == 6);
+
+    t_gnl_mux mux;
+    assert(gnl_mux_init(&mux, fds, 2, 4096) == 0);
+    size_t which;
+    t_gnl_view view;
+    assert(gnl_mux_next(&mux, &which, &view, -1) == GNL_LINE);
+    assert(which == 1 && view.len == 3 && memcmp(view.data, "q1\n", 3) == 0);
+    assert(gnl_mux_next(&mux, &which, &view, -1) == GNL_LINE);
+    assert(which == 1 && memcmp(view.data, "q2\n", 3) == 0);
+    assert(mux.readers[0].end - mux.readers[0].start <= 3 * 4096);
+
+    assert(gnl_mux_next(&mux, &which, &view, -1) == GNL_LINE);
+    assert(which == 0 && view.len == len + 1);
+    assert(gnl_mux_next(&mux, &which, &view, 0) == GNL_AGAIN);
+    assert(write(quiet[1], "q3", 2) == 2);
+    close(quiet[1]);
+    assert(gnl_mux_next(&mux, &which, &view, -1) == GNL_LINE);
+    assert(which == 1 && view.len == 2 && memcmp(view.data, "q3", 2) == 0);
+    assert(gnl_mux_next(&mux, &which, &view, -1) == GNL_EOF);
+    gnl_mux_destroy(&mux);
+    close(fds[0]);
+    close(fds[1]);
+}
+
+void test_batch_blocks() {
+    const char payload[] = "aa\nbbbb\ncc\nthis line is longer than target\nd\ntail";
+
+    t_gnl_reader reader;
+    gnl_reader_init_mem(&reader, payload, strlen(payload));
+    t_gnl_batch batch;
+    assert(gnl_batch_init(&batch, 12) == 0);
+    assert(((size_t)batch.data & (GNL_CACHE_LINE - 1)) == 0);
+
+    // Lines are packed back to back with Arrow-style offsets
+    assert(gnl_reader_next_batch(&reader, &batch) == GNL_LINE);
+    assert(batch.count == 3 && batch.size == 11);
+    assert(batch.offsets[0] == 0 && batch.offsets[1] == 3);
+    assert(batch.offsets[2] == 8 && batch.offsets[3] == 11);
+    assert(memcmp(batch.data, "aa\nbbbb\ncc\n", 11) == 0);
+
+    // An oversized line gets a block of its own
+    assert(gnl_reader_next_batch(&reader, &batch) == GNL_LINE);
+    assert(batch.count == 1 && batch.size == 32);
+    assert(gnl_reader_next_batch(&reader, &batch) == GNL_LINE);
+    assert(batch.count == 2 && batch.offsets[2] == 6);
+    assert(memcmp(batch.data, "d\ntail", 6) == 0);
+    assert(gnl_reader_next_batch(&reader, &batch) == GNL_EOF);
+    assert(reader.lines == 6 && reader.offset == (off_t)strlen(payload));
+    gnl_reader_destroy(&reader);
+
+    // Blocks from a file concatenate back to the original bytes
+    FILE *file = fopen("test_batch.txt", "w");
+    for (int i = 0; i < 20000; i++)
+        fprintf(file, "event %d %.*s\n", i, i % 70,
+            "======================================================================");
+    fclose(file);
+    int fd = open("test_batch.txt", O_RDONLY);
+    assert(fd != -1);
+    file = fopen("test_batch.txt", "r");
+    fseek(file, 0, SEEK_END);
+    size_t total = (size_t)ftell(file);
+    rewind(file);
+    char *whole = malloc(total);
+    assert(whole && fread(whole, 1, total, file) == total);
+    fclose(file);
+    assert(gnl_reader_init(&reader, gnl_source_fd(fd)) == 0);
+    gnl_batch_destroy(&batch);
+    assert(gnl_batch_init(&batch, 4096) == 0);
+    size_t pos = 0;
+    size_t lines = 0;
+    while (gnl_reader_next_batch(&reader, &batch) == GNL_LINE) {
+        assert(batch.size <= 4096);
+        assert(batch.offsets[batch.count] == (int32_t)batch.size);
+        assert(memcmp(whole + pos, batch.data, batch.size) == 0);
+        assert(batch.data[batch.offsets[1] - 1] == '\n');
+        pos += batch.size;
+        lines += batch.count;
+    }
+    assert(pos == total && lines == 20000);
+    free(whole);
+    gnl_batch_destroy(&batch);
+    gnl_reader_destroy(&reader);
+    close(fd);
+}
+
+void test_reader_invalid_fd() {
+    t_gnl_reader reader;
+    assert(gnl_reader_init(&reader, gnl_source_fd(-1)) == 0);
+
+    t_gnl_view view;
+    assert(gnl_reader_next_view(&reader, &view) == GNL_ERROR);
+    gnl_reader_destroy(&reader);
+}
+
+int main() {
+    test_reader_fd();
+    test_reader_long_lines();
+    test_reader_gzip();
+    test_reader_gzip_truncated();
+    test_reader_memory();
+    test_reader_file();
+    test_reader_callback();
+    test_record_tsv();
+    test_record_csv_quoted();
+    test_record_many_fields();
+    test_index_seek();
+    test_reverse_lines();
+    test_reverse_long_line();
+    test_utf8_flags();
+    test_utf8_split_reads();
+    test_filter_literals();
+    test_filter_split_match();
+    test_pipeline_workers();
+    test_pipeline_parks();
+    test_scan_files();
+    test_forward_file();
+    test_forward_stream();
+    test_writer_batches();
+    test_writer_latency();
+    test_reader_reserve();
+#ifdef GNL_TRACE
+    test_trace_phases();
+#endif
+    test_reader_nonblocking();
+    test_reader_direct();
+    test_checkpoint_resume();
+    test_intern_lines();
+    test_mux_fairness();
+    test_mux_deadline();
+    test_batch_blocks();
+    test_reader_invalid_fd();
+
+    printf("All tests passed.\n");
+    return 0;
+}